@@ -0,0 +1,374 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextBase.h"
+#include "SafeContextException.h"
+#include "SafeContextStatistics.h"
+#include "SafeWarmUp.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ structure: `SafeAdaptivePolicy`.
+	/// </summary>
+	struct SafeAdaptivePolicy
+	{
+		double growthMissRate = 0.25;
+		std::uint64_t minimumRequestCount = 64;
+		std::size_t growthFactor = 2;
+		std::size_t maximumGrowthCount = 4096;
+	};
+
+	/// <summary>
+	///		C++ class: `SafeAdaptivePool`.
+	/// </summary>
+	class SafeAdaptivePool final
+	{
+	private:
+		/// <summary>
+		///		C++ structure: `SafeAdaptiveEntry`.
+		/// </summary>
+		struct SafeAdaptiveEntry
+		{
+			SafeTypeStatistics* statisticsPointer;
+			std::size_t (*reserveFunction)(const std::size_t& reservedCount);
+			std::uint64_t previousHitCount;
+			std::uint64_t previousMissCount;
+			bool grown;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeAdaptiveGrowth`.
+		/// </summary>
+		struct SafeAdaptiveGrowth
+		{
+			std::size_t (*reserveFunction)(const std::size_t& reservedCount);
+			std::size_t reservedCount;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeAdaptiveState`.
+		/// </summary>
+		struct SafeAdaptiveState
+		{
+			std::mutex stateMutex;
+			std::condition_variable stateCondition;
+			std::vector<SafeAdaptiveEntry> entries;
+			SafeAdaptivePolicy policy;
+			std::thread adaptingThread;
+			std::uint64_t failureCount = 0;
+			bool adapting = false;
+
+			/// <summary>
+			///		Destructor of `SafeAdaptiveState`.
+			/// </summary>
+			inline ~SafeAdaptiveState()
+			{
+				{
+					std::lock_guard<std::mutex> stateLock(this->stateMutex);
+
+					this->adapting = false;
+				}
+
+				(this->stateCondition).notify_all();
+
+				if ((this->adaptingThread).joinable() == true)
+				{
+					(this->adaptingThread).join();
+				}
+			};
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>SafeAdaptiveState&amp;</returns>
+		static inline SafeAdaptiveState& referToState()
+		{
+			static SafeAdaptiveState state;
+
+			return state;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		/// <param name="reservedCount"></param>
+		/// <returns>size_t</returns>
+		template<typename GenericTypeOfSafeContextDerivative> static inline std::size_t reserveOf(const std::size_t& reservedCount)
+		{
+			return SafeContextBase::reserve<GenericTypeOfSafeContextDerivative>(reservedCount);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>exception_ptr</returns>
+		static inline std::exception_ptr adaptOnce()
+		{
+			SafeAdaptiveState& state = SafeAdaptivePool::referToState();
+			std::vector<SafeAdaptiveGrowth> growths = std::vector<SafeAdaptiveGrowth>();
+			std::exception_ptr failurePointer = nullptr;
+			std::uint64_t failureCount = 0;
+			std::size_t i = 0;
+
+			{
+				std::lock_guard<std::mutex> stateLock(state.stateMutex);
+				SafeAdaptivePolicy policy = state.policy;
+
+				for (i = 0;i < (state.entries).size();i++)
+				{
+					SafeAdaptiveEntry& entry = (state.entries)[i];
+					std::uint64_t hitCount = entry.statisticsPointer->getRepurposeHitCount();
+					std::uint64_t missCount = entry.statisticsPointer->getRepurposeMissCount();
+					std::uint64_t windowHitCount = hitCount - entry.previousHitCount;
+					std::uint64_t windowMissCount = missCount - entry.previousMissCount;
+					std::uint64_t windowRequestCount = windowHitCount + windowMissCount;
+
+					entry.previousHitCount = hitCount;
+					entry.previousMissCount = missCount;
+
+					if ((windowRequestCount >= policy.minimumRequestCount) && (windowRequestCount > 0) && ((static_cast<double>(windowMissCount) / static_cast<double>(windowRequestCount)) > policy.growthMissRate))
+					{
+						std::size_t grownCount = static_cast<std::size_t>(windowMissCount) * policy.growthFactor;
+
+						entry.grown = true;
+						entry.statisticsPointer->recordPoolDecision(SafePoolDecision::Grow);
+						growths.push_back(SafeAdaptiveGrowth{entry.reserveFunction,((grownCount > policy.maximumGrowthCount) ? policy.maximumGrowthCount : grownCount)});
+					}
+					else if ((entry.grown == true) && (windowMissCount == 0) && (windowRequestCount < policy.minimumRequestCount))
+					{
+						entry.statisticsPointer->recordPoolDecision(SafePoolDecision::Shrink);
+					}
+					else
+					{
+						entry.statisticsPointer->recordPoolDecision(SafePoolDecision::Keep);
+					}
+				}
+			}
+
+			for (i = 0;i < growths.size();i++)
+			{
+				try
+				{
+					((growths[i]).reserveFunction)((growths[i]).reservedCount);
+				}
+				catch (...)
+				{
+					if (failurePointer == nullptr)
+					{
+						failurePointer = std::current_exception();
+					}
+
+					failureCount++;
+				}
+			}
+
+			if (failureCount > 0)
+			{
+				std::lock_guard<std::mutex> stateLock(state.stateMutex);
+
+				state.failureCount += failureCount;
+			}
+
+			return failurePointer;
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		/// <returns>void</returns>
+		template<typename GenericTypeOfSafeContextDerivative> static inline void enlist()
+		{
+			SafeAdaptiveState& state = SafeAdaptivePool::referToState();
+			SafeTypeStatistics& statisticsReference = SafeContextStatistics::referToTypeStatistics<GenericTypeOfSafeContextDerivative>();
+			std::lock_guard<std::mutex> stateLock(state.stateMutex);
+
+			for (const SafeAdaptiveEntry& entry : state.entries)
+			{
+				if (entry.statisticsPointer == std::addressof(statisticsReference))
+				{
+					return;
+				}
+			}
+
+			statisticsReference.setMissTiming(true);
+			(state.entries).push_back(SafeAdaptiveEntry{std::addressof(statisticsReference),&SafeAdaptivePool::reserveOf<GenericTypeOfSafeContextDerivative>,statisticsReference.getRepurposeHitCount(),statisticsReference.getRepurposeMissCount(),false});
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="policy"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline void setPolicy(const SafeAdaptivePolicy& policy)
+		{
+			if ((policy.growthMissRate < 0.0) || (policy.growthMissRate > 1.0))
+			{
+				throw SafeContextException("Argument `policy.growthMissRate` must be between 0 and 1!");
+			}
+
+			SafeAdaptiveState& state = SafeAdaptivePool::referToState();
+			std::lock_guard<std::mutex> stateLock(state.stateMutex);
+
+			state.policy = policy;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>SafeAdaptivePolicy</returns>
+		static inline SafeAdaptivePolicy getPolicy()
+		{
+			SafeAdaptiveState& state = SafeAdaptivePool::referToState();
+			std::lock_guard<std::mutex> stateLock(state.stateMutex);
+
+			return state.policy;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline void adapt()
+		{
+			std::exception_ptr failurePointer = SafeAdaptivePool::adaptOnce();
+
+			if (failurePointer != nullptr)
+			{
+				std::rethrow_exception(failurePointer);
+			}
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="period"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline void start(const std::chrono::milliseconds& period)
+		{
+			if (period.count() <= 0)
+			{
+				throw SafeContextException("Argument `period` must be positive!");
+			}
+
+			SafeAdaptiveState& state = SafeAdaptivePool::referToState();
+			std::lock_guard<std::mutex> stateLock(state.stateMutex);
+
+			if ((state.adaptingThread).joinable() == true)
+			{
+				throw SafeContextException("The adaptive pool is already started!");
+			}
+
+			state.adapting = true;
+			state.adaptingThread = std::thread([&state,period]() -> void
+			{
+				std::unique_lock<std::mutex> adaptingLock(state.stateMutex);
+
+				while (state.adapting == true)
+				{
+					if ((state.stateCondition).wait_for(adaptingLock,period,[&state]() -> bool
+					{
+						return (state.adapting == false);
+					}) == true)
+					{
+						break;
+					}
+
+					adaptingLock.unlock();
+					static_cast<void>(SafeAdaptivePool::adaptOnce());
+					adaptingLock.lock();
+				}
+			});
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		static inline std::uint64_t getFailureCount()
+		{
+			SafeAdaptiveState& state = SafeAdaptivePool::referToState();
+			std::lock_guard<std::mutex> stateLock(state.stateMutex);
+
+			return state.failureCount;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>void</returns>
+		static inline void stop()
+		{
+			SafeAdaptiveState& state = SafeAdaptivePool::referToState();
+			std::thread adaptingThread;
+
+			{
+				std::lock_guard<std::mutex> stateLock(state.stateMutex);
+
+				state.adapting = false;
+				adaptingThread = static_cast<std::thread&&>(state.adaptingThread);
+			}
+
+			(state.stateCondition).notify_all();
+
+			if (adaptingThread.joinable() == true)
+			{
+				adaptingThread.join();
+			}
+		};
+	};
+};
\ No newline at end of file
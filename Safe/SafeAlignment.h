@@ -0,0 +1,74 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <cstddef>
+#include <type_traits>
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ structure template: `SafeAlignmentPolicy`.
+	/// </summary>
+	/// <typeparam name="GenericAlignment"></typeparam>
+	template<std::size_t GenericAlignment> struct SafeAlignmentPolicy
+	{
+		static_assert((GenericAlignment > 0) && ((GenericAlignment & (GenericAlignment - 1)) == 0),"`GenericAlignment` must be a power of two!");
+
+
+		static constexpr std::size_t alignment = GenericAlignment;
+	};
+
+	/// <summary>
+	///		C++ type name alias: `SafeCacheLineAlignment`.
+	/// </summary>
+	using SafeCacheLineAlignment = SafeAlignmentPolicy<64>;
+
+	/// <summary>
+	///		C++ type name alias: `SafeDoubleCacheLineAlignment`.
+	/// </summary>
+	using SafeDoubleCacheLineAlignment = SafeAlignmentPolicy<128>;
+
+	/// <summary>
+	///		C++ structure template: `SafeAlignmentTraits`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> struct SafeAlignmentTraits : SafeAlignmentPolicy<alignof(GenericTypeOfSafeContextDerivative)>
+	{
+
+	};
+
+	/// <summary>
+	///		C++ structure template: `SafeAlignedLayout`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> struct SafeAlignedLayout
+	{
+		static constexpr std::size_t alignment = ((SafeAlignmentTraits<GenericTypeOfSafeContextDerivative>::alignment > alignof(GenericTypeOfSafeContextDerivative)) ? SafeAlignmentTraits<GenericTypeOfSafeContextDerivative>::alignment : alignof(GenericTypeOfSafeContextDerivative));
+		static constexpr std::size_t stride = ((sizeof(GenericTypeOfSafeContextDerivative) + alignment - 1) / alignment) * alignment;
+	};
+};
\ No newline at end of file
@@ -0,0 +1,271 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class: `SafeArrayBins`.
+	/// </summary>
+	class SafeArrayBins final
+	{
+	private:
+		static constexpr std::size_t minimumBinBitWidth = 6;
+		static constexpr std::size_t maximumBinBitWidth = 20;
+		static constexpr std::size_t binCount = (SafeArrayBins::maximumBinBitWidth - SafeArrayBins::minimumBinBitWidth + 1);
+		static constexpr std::size_t cachedCapacityPerBin = (static_cast<std::size_t>(1) << 22);
+		static constexpr std::size_t headerSize = alignof(std::max_align_t);
+
+		/// <summary>
+		///		C++ structure: `SafeArrayBin`.
+		/// </summary>
+		struct SafeArrayBin
+		{
+			void* headBlockPointer;
+			std::size_t cachedCount;
+		};
+
+		SafeArrayBin bins[SafeArrayBins::binCount];
+
+
+		/// <summary>
+		///		Constructor of `SafeArrayBins`.
+		/// </summary>
+		inline explicit SafeArrayBins() noexcept : bins()
+		{
+
+		};
+
+		/// <summary>
+		///		Copy constructor of `SafeArrayBins`.
+		/// </summary>
+		inline SafeArrayBins(const SafeArrayBins&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeArrayBins`.
+		/// </summary>
+		inline SafeArrayBins(SafeArrayBins&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeArrayBins`.
+		/// </summary>
+		inline ~SafeArrayBins()
+		{
+			std::size_t i = 0;
+
+			for (i = 0;i < SafeArrayBins::binCount;i++)
+			{
+				while ((this->bins)[i].headBlockPointer != nullptr)
+				{
+					void* nextBlockPointer = *static_cast<void**>((this->bins)[i].headBlockPointer);
+
+					::operator delete((this->bins)[i].headBlockPointer);
+					(this->bins)[i].headBlockPointer = nextBlockPointer;
+				}
+			}
+		};
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeArrayBins&amp;</returns>
+		inline SafeArrayBins& operator=(const SafeArrayBins&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeArrayBins&amp;</returns>
+		inline SafeArrayBins& operator=(SafeArrayBins&&) = delete;
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>SafeArrayBins&amp;</returns>
+		static inline SafeArrayBins& referToBins() noexcept
+		{
+			static thread_local SafeArrayBins bins;
+
+			return bins;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="blockSize"></param>
+		/// <returns>size_t</returns>
+		static inline std::size_t locateBin(const std::size_t& blockSize) noexcept
+		{
+			std::size_t binIndex = 0;
+
+			while ((static_cast<std::size_t>(1) << (SafeArrayBins::minimumBinBitWidth + binIndex)) < blockSize)
+			{
+				binIndex++;
+			}
+
+			return binIndex;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="binIndex"></param>
+		/// <returns>size_t</returns>
+		static inline std::size_t getBinBlockSize(const std::size_t& binIndex) noexcept
+		{
+			return (static_cast<std::size_t>(1) << (SafeArrayBins::minimumBinBitWidth + binIndex));
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="memoryArraySize"></param>
+		/// <returns>void*</returns>
+		static inline void* allocate(const std::size_t& memoryArraySize)
+		{
+			std::size_t blockSize = memoryArraySize + SafeArrayBins::headerSize;
+			void* blockPointer = nullptr;
+			std::size_t binIndex = SafeArrayBins::binCount;
+
+			if (blockSize <= SafeArrayBins::getBinBlockSize(SafeArrayBins::binCount - 1))
+			{
+				SafeArrayBins& bins = SafeArrayBins::referToBins();
+
+				binIndex = SafeArrayBins::locateBin(blockSize);
+
+				if ((bins.bins)[binIndex].headBlockPointer != nullptr)
+				{
+					blockPointer = (bins.bins)[binIndex].headBlockPointer;
+					(bins.bins)[binIndex].headBlockPointer = *static_cast<void**>(blockPointer);
+					(bins.bins)[binIndex].cachedCount--;
+				}
+				else
+				{
+					blockPointer = ::operator new(SafeArrayBins::getBinBlockSize(binIndex));
+				}
+			}
+			else
+			{
+				blockPointer = ::operator new(blockSize);
+			}
+
+			*static_cast<std::size_t*>(blockPointer) = binIndex;
+
+			return static_cast<unsigned char*>(blockPointer) + SafeArrayBins::headerSize;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="memoryArrayPointer"></param>
+		/// <returns>void</returns>
+		static inline void deallocate(void* const memoryArrayPointer) noexcept
+		{
+			if (memoryArrayPointer == nullptr)
+			{
+				return;
+			}
+
+			void* blockPointer = static_cast<unsigned char*>(memoryArrayPointer) - SafeArrayBins::headerSize;
+			std::size_t binIndex = *static_cast<std::size_t*>(blockPointer);
+
+			if (binIndex < SafeArrayBins::binCount)
+			{
+				SafeArrayBins& bins = SafeArrayBins::referToBins();
+
+				if (((bins.bins)[binIndex].cachedCount + 1) * SafeArrayBins::getBinBlockSize(binIndex) <= SafeArrayBins::cachedCapacityPerBin)
+				{
+					*static_cast<void**>(blockPointer) = (bins.bins)[binIndex].headBlockPointer;
+					(bins.bins)[binIndex].headBlockPointer = blockPointer;
+					(bins.bins)[binIndex].cachedCount++;
+
+					return;
+				}
+			}
+
+			::operator delete(blockPointer);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline std::size_t getCachedSize() noexcept
+		{
+			SafeArrayBins& bins = SafeArrayBins::referToBins();
+			std::size_t cachedSize = 0;
+			std::size_t i = 0;
+
+			for (i = 0;i < SafeArrayBins::binCount;i++)
+			{
+				cachedSize += (bins.bins)[i].cachedCount * SafeArrayBins::getBinBlockSize(i);
+			}
+
+			return cachedSize;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="memoryArraySize"></param>
+		/// <returns>size_t</returns>
+		static inline std::size_t getCachedCount(const std::size_t& memoryArraySize) noexcept
+		{
+			std::size_t blockSize = memoryArraySize + SafeArrayBins::headerSize;
+
+			if (blockSize > SafeArrayBins::getBinBlockSize(SafeArrayBins::binCount - 1))
+			{
+				return 0;
+			}
+
+			return (SafeArrayBins::referToBins().bins)[SafeArrayBins::locateBin(blockSize)].cachedCount;
+		};
+	};
+};
\ No newline at end of file
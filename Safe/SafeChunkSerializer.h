@@ -0,0 +1,382 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextBase.h"
+#include "SafeContextException.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class template: `SafeChunkSerializer`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	/// <typeparam name="GenericTypeOfCodec"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative,typename GenericTypeOfCodec> class SafeChunkSerializer final : public SafeContextBase
+	{
+		static_assert((std::is_base_of<SafeContextBase,GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type inherited from `SafeContextBase`!");
+		static_assert((GenericTypeOfCodec::recordSize > 0),"`GenericTypeOfCodec::recordSize` must be positive!");
+
+	private:
+		static constexpr std::uint32_t version = 1;
+		static constexpr std::uint32_t checksumFlag = 1;
+		static constexpr std::uint64_t checksumBasis = 14695981039346656037ULL;
+		static constexpr std::uint64_t checksumPrime = 1099511628211ULL;
+
+		GenericTypeOfCodec codec;
+		std::size_t batchCardinality;
+		bool checksumming;
+		std::size_t batchBufferCardinality;
+		std::unique_ptr<unsigned char[]> batchBufferPointer;
+
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="checksum"></param>
+		/// <param name="bytePointer"></param>
+		/// <param name="byteCount"></param>
+		/// <returns>uint64_t</returns>
+		static inline std::uint64_t accumulateChecksum(std::uint64_t checksum,const unsigned char* const bytePointer,const std::size_t& byteCount) noexcept
+		{
+			std::size_t i = 0;
+
+			for (i = 0;i < byteCount;i++)
+			{
+				checksum = (checksum ^ bytePointer[i]) * SafeChunkSerializer::checksumPrime;
+			}
+
+			return checksum;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="stream"></param>
+		/// <param name="value"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline void writeInteger(std::ostream& stream,const std::uint64_t& value)
+		{
+			unsigned char bytes[8];
+			std::size_t i = 0;
+
+			for (i = 0;i < 8;i++)
+			{
+				bytes[i] = static_cast<unsigned char>((value >> (8 * i)) & 0xFF);
+			}
+
+			SafeChunkSerializer::writeBytes(stream,bytes,8);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="stream"></param>
+		/// <returns>uint64_t</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline std::uint64_t readInteger(std::istream& stream)
+		{
+			unsigned char bytes[8];
+			std::uint64_t value = 0;
+			std::size_t i = 0;
+
+			SafeChunkSerializer::readBytes(stream,bytes,8);
+
+			for (i = 0;i < 8;i++)
+			{
+				value |= (static_cast<std::uint64_t>(bytes[i]) << (8 * i));
+			}
+
+			return value;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="stream"></param>
+		/// <param name="bytePointer"></param>
+		/// <param name="byteCount"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline void writeBytes(std::ostream& stream,const unsigned char* const bytePointer,const std::size_t& byteCount)
+		{
+			if (stream.write(reinterpret_cast<const char*>(bytePointer),static_cast<std::streamsize>(byteCount)).good() == false)
+			{
+				throw SafeContextException("Unable to write `" + std::to_string(byteCount) + "` byte(s) to the stream!");
+			}
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="stream"></param>
+		/// <param name="bytePointer"></param>
+		/// <param name="byteCount"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline void readBytes(std::istream& stream,unsigned char* const bytePointer,const std::size_t& byteCount)
+		{
+			if (stream.read(reinterpret_cast<char*>(bytePointer),static_cast<std::streamsize>(byteCount)).gcount() != static_cast<std::streamsize>(byteCount))
+			{
+				throw SafeContextException("Unexpected end of stream while reading `" + std::to_string(byteCount) + "` byte(s)!");
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="requiredCardinality"></param>
+		/// <returns>unsigned char*</returns>
+		/// <exception cref="SafeContextException"/>
+		inline unsigned char* referToBatchBuffer(const std::size_t& requiredCardinality)
+		{
+			if (requiredCardinality > (std::numeric_limits<std::size_t>::max() / GenericTypeOfCodec::recordSize))
+			{
+				throw SafeContextException("A block of `" + std::to_string(requiredCardinality) + "` record(s) is too large!");
+			}
+
+			if (requiredCardinality > this->batchBufferCardinality)
+			{
+				this->batchBufferPointer = std::unique_ptr<unsigned char[]>(::new unsigned char[requiredCardinality * GenericTypeOfCodec::recordSize]);
+				this->batchBufferCardinality = requiredCardinality;
+			}
+
+			return (this->batchBufferPointer).get();
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeChunkSerializer`.
+		/// </summary>
+		/// <param name="codec"></param>
+		/// <param name="batchCardinality"></param>
+		/// <param name="checksumming"></param>
+		inline explicit SafeChunkSerializer(const GenericTypeOfCodec& codec = GenericTypeOfCodec(),const std::size_t& batchCardinality = 4096,const bool& checksumming = true) : SafeContextBase(),codec(codec),batchBufferCardinality(0)
+		{
+			if (batchCardinality == 0)
+			{
+				throw SafeContextException("Argument `batchCardinality` must be positive!");
+			}
+
+			this->batchCardinality = batchCardinality;
+			this->checksumming = checksumming;
+			this->referToBatchBuffer(batchCardinality);
+		};
+
+	private:
+		/// <summary>
+		///		Copy constructor of `SafeChunkSerializer`.
+		/// </summary>
+		inline SafeChunkSerializer(const SafeChunkSerializer&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeChunkSerializer`.
+		/// </summary>
+		inline SafeChunkSerializer(SafeChunkSerializer&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeChunkSerializer`.
+		/// </summary>
+		inline virtual ~SafeChunkSerializer() noexcept(false) override = default;
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeChunkSerializer&amp;</returns>
+		inline SafeChunkSerializer& operator=(const SafeChunkSerializer&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeChunkSerializer&amp;</returns>
+		inline SafeChunkSerializer& operator=(SafeChunkSerializer&&) = delete;
+
+	public:
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfChunk"></typeparam>
+		/// <param name="chunkReference"></param>
+		/// <param name="stream"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		template<typename GenericTypeOfChunk> inline void serialize(const GenericTypeOfChunk& chunkReference,std::ostream& stream)
+		{
+			const std::size_t cardinality = chunkReference.getCardinality();
+			unsigned char* const batchBufferPointer = (this->batchBufferPointer).get();
+			std::size_t i = 0;
+
+			SafeChunkSerializer::writeBytes(stream,reinterpret_cast<const unsigned char*>("SAFECHNK"),8);
+			SafeChunkSerializer::writeInteger(stream,(static_cast<std::uint64_t>((this->checksumming == true) ? SafeChunkSerializer::checksumFlag : 0) << 32) | SafeChunkSerializer::version);
+			SafeChunkSerializer::writeInteger(stream,GenericTypeOfCodec::recordSize);
+			SafeChunkSerializer::writeInteger(stream,cardinality);
+
+			while (i < cardinality)
+			{
+				std::size_t blockCardinality = ((cardinality - i) < this->batchCardinality) ? (cardinality - i) : this->batchCardinality;
+				std::size_t j = 0;
+
+				for (j = 0;j < blockCardinality;j++)
+				{
+					(this->codec).encode(chunkReference[i + j],batchBufferPointer + (j * GenericTypeOfCodec::recordSize));
+				}
+
+				SafeChunkSerializer::writeInteger(stream,blockCardinality);
+
+				if (this->checksumming == true)
+				{
+					SafeChunkSerializer::writeInteger(stream,SafeChunkSerializer::accumulateChecksum(SafeChunkSerializer::checksumBasis,batchBufferPointer,blockCardinality * GenericTypeOfCodec::recordSize));
+				}
+
+				SafeChunkSerializer::writeBytes(stream,batchBufferPointer,blockCardinality * GenericTypeOfCodec::recordSize);
+				i += blockCardinality;
+			}
+
+			SafeChunkSerializer::writeInteger(stream,0);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfChunk"></typeparam>
+		/// <param name="stream"></param>
+		/// <param name="chunkReference"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		template<typename GenericTypeOfChunk> inline void deserialize(std::istream& stream,GenericTypeOfChunk& chunkReference)
+		{
+			unsigned char signature[8];
+			std::size_t i = 0;
+
+			SafeChunkSerializer::readBytes(stream,signature,8);
+
+			if (std::memcmp(signature,"SAFECHNK",8) != 0)
+			{
+				throw SafeContextException("The stream doesn't contain a serialized chunk!");
+			}
+
+			std::uint64_t versionAndFlags = SafeChunkSerializer::readInteger(stream);
+			bool checksumming = (((versionAndFlags >> 32) & SafeChunkSerializer::checksumFlag) != 0);
+			std::uint64_t recordSize = SafeChunkSerializer::readInteger(stream);
+			std::uint64_t cardinality = SafeChunkSerializer::readInteger(stream);
+
+			if ((versionAndFlags & 0xFFFFFFFFULL) != SafeChunkSerializer::version)
+			{
+				throw SafeContextException("Unsupported serialization version: `" + std::to_string(versionAndFlags & 0xFFFFFFFFULL) + "`!");
+			}
+
+			if (recordSize != GenericTypeOfCodec::recordSize)
+			{
+				throw SafeContextException("Record size mismatch: `" + std::to_string(recordSize) + "` while the codec expects `" + std::to_string(GenericTypeOfCodec::recordSize) + "`!");
+			}
+
+			if (cardinality != chunkReference.getCardinality())
+			{
+				throw SafeContextException("Cardinality mismatch: `" + std::to_string(cardinality) + "` while the chunk has `" + std::to_string(chunkReference.getCardinality()) + "`!");
+			}
+
+			while (true)
+			{
+				std::uint64_t blockCardinality = SafeChunkSerializer::readInteger(stream);
+				std::uint64_t expectedChecksum = 0;
+				unsigned char* blockBufferPointer = nullptr;
+				std::size_t j = 0;
+
+				if (blockCardinality == 0)
+				{
+					break;
+				}
+
+				if (blockCardinality > (cardinality - i))
+				{
+					throw SafeContextException("The stream holds more records than the chunk cardinality `" + std::to_string(cardinality) + "`!");
+				}
+
+				if (checksumming == true)
+				{
+					expectedChecksum = SafeChunkSerializer::readInteger(stream);
+				}
+
+				blockBufferPointer = this->referToBatchBuffer(static_cast<std::size_t>(blockCardinality));
+				SafeChunkSerializer::readBytes(stream,blockBufferPointer,static_cast<std::size_t>(blockCardinality) * GenericTypeOfCodec::recordSize);
+
+				if ((checksumming == true) && (SafeChunkSerializer::accumulateChecksum(SafeChunkSerializer::checksumBasis,blockBufferPointer,static_cast<std::size_t>(blockCardinality) * GenericTypeOfCodec::recordSize) != expectedChecksum))
+				{
+					throw SafeContextException("Checksum mismatch in the block starting at record `" + std::to_string(i) + "`!");
+				}
+
+				for (j = 0;j < blockCardinality;j++)
+				{
+					(this->codec).decode(blockBufferPointer + (j * GenericTypeOfCodec::recordSize),chunkReference[i + j]);
+				}
+
+				i += static_cast<std::size_t>(blockCardinality);
+			}
+
+			if (i != cardinality)
+			{
+				throw SafeContextException("The stream holds `" + std::to_string(i) + "` record(s) while the chunk has `" + std::to_string(cardinality) + "`!");
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getBatchCardinality() const noexcept
+		{
+			return this->batchCardinality;
+		};
+	};
+};
\ No newline at end of file
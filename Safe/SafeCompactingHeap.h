@@ -0,0 +1,577 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextBase.h"
+#include "SafeContextException.h"
+#include "SafeTraits.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	template<typename GenericType> class SafeCompactingHeap;
+
+	/// <summary>
+	///		C++ class template: `SafeHandle`.
+	/// </summary>
+	/// <typeparam name="GenericType"></typeparam>
+	template<typename GenericType> class SafeHandle final
+	{
+		friend class SafeCompactingHeap<GenericType>;
+
+	private:
+		SafeCompactingHeap<GenericType>* heapPointer;
+		std::uint32_t entryIndex;
+		std::uint32_t generation;
+
+		/// <summary>
+		///		Constructor of `SafeHandle`.
+		/// </summary>
+		/// <param name="heapPointer"></param>
+		/// <param name="entryIndex"></param>
+		/// <param name="generation"></param>
+		inline explicit SafeHandle(SafeCompactingHeap<GenericType>* const heapPointer,const std::uint32_t& entryIndex,const std::uint32_t& generation) noexcept : heapPointer(heapPointer),entryIndex(entryIndex),generation(generation)
+		{
+
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeHandle`.
+		/// </summary>
+		inline explicit SafeHandle() noexcept : heapPointer(nullptr),entryIndex(0),generation(0)
+		{
+
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>GenericType*</returns>
+		inline GenericType* get() const noexcept;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		///		operator-&gt;
+		/// </summary>
+		/// <returns>GenericType*</returns>
+		inline GenericType* operator->() const noexcept
+		{
+			return this->get();
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		///		operator*
+		/// </summary>
+		/// <returns>GenericType&amp;</returns>
+		inline GenericType& operator*() const noexcept
+		{
+			return *(this->get());
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>bool</returns>
+		inline bool isValid() const noexcept
+		{
+			return (this->get() != nullptr);
+		};
+	};
+
+	/// <summary>
+	///		C++ class template: `SafeCompactingHeap`.
+	/// </summary>
+	/// <typeparam name="GenericType"></typeparam>
+	template<typename GenericType> class SafeCompactingHeap final
+	{
+		static_assert((std::is_base_of<SafeContextBase,GenericType>::value == false),"`GenericType` can't be a tracked type, because the runtime library keeps the addresses of tracked instances!");
+		static_assert((SafeRelocationHook<GenericType>::value == true),"`GenericType` must specialize `SafeRelocationHook`!");
+
+	private:
+		static constexpr std::uint32_t invalidIndex = static_cast<std::uint32_t>(-1);
+		static constexpr std::size_t defaultSlabSize = 65536;
+		static constexpr std::size_t slabAlignment = ((alignof(GenericType) > 64) ? alignof(GenericType) : 64);
+
+		/// <summary>
+		///		C++ structure: `SafeSlab`.
+		/// </summary>
+		struct SafeSlab
+		{
+			unsigned char* storagePointer;
+			std::vector<std::uint32_t> entryIndices;
+			std::vector<std::uint32_t> freeSlotIndices;
+			std::size_t liveCount;
+			std::size_t slabIndex;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeHandleEntry`.
+		/// </summary>
+		struct SafeHandleEntry
+		{
+			GenericType* instancePointer;
+			SafeSlab* slabPointer;
+			std::uint32_t slotIndex;
+			std::uint32_t generation;
+			std::uint32_t nextFreeEntryIndex;
+		};
+
+		std::vector<SafeHandleEntry> entries;
+		std::uint32_t freeEntryIndex;
+		std::vector<std::unique_ptr<SafeSlab>> slabs;
+		std::size_t partialSlabIndex;
+		std::size_t slabCapacity;
+		std::size_t liveCount;
+
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="slabReference"></param>
+		/// <param name="slotIndex"></param>
+		/// <returns>GenericType*</returns>
+		inline GenericType* referToSlot(const SafeSlab& slabReference,const std::uint32_t& slotIndex) const noexcept
+		{
+			return reinterpret_cast<GenericType*>(slabReference.storagePointer + (static_cast<std::size_t>(slotIndex) * sizeof(GenericType)));
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>SafeSlab&amp;</returns>
+		inline SafeSlab& referToPartialSlab()
+		{
+			while ((this->partialSlabIndex < (this->slabs).size()) && (((this->slabs)[this->partialSlabIndex])->freeSlotIndices.empty() == true))
+			{
+				(this->partialSlabIndex)++;
+			}
+
+			if (this->partialSlabIndex == (this->slabs).size())
+			{
+				std::unique_ptr<SafeSlab> slab = std::unique_ptr<SafeSlab>(new SafeSlab{nullptr,std::vector<std::uint32_t>(this->slabCapacity,SafeCompactingHeap::invalidIndex),std::vector<std::uint32_t>(),0,(this->slabs).size()});
+				std::size_t i = 0;
+
+				(slab->freeSlotIndices).reserve(this->slabCapacity);
+
+				for (i = this->slabCapacity;i > 0;i--)
+				{
+					(slab->freeSlotIndices).push_back(static_cast<std::uint32_t>(i - 1));
+				}
+
+				(this->slabs).reserve((this->slabs).size() + 1);
+				slab->storagePointer = static_cast<unsigned char*>(::operator new(this->slabCapacity * sizeof(GenericType),std::align_val_t(SafeCompactingHeap::slabAlignment)));
+				(this->slabs).push_back(static_cast<std::unique_ptr<SafeSlab>&&>(slab));
+			}
+
+			return *((this->slabs)[this->partialSlabIndex]);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="slabReference"></param>
+		/// <returns>void</returns>
+		inline void releaseSlab(SafeSlab& slabReference) noexcept
+		{
+			::operator delete(static_cast<void*>(slabReference.storagePointer),std::align_val_t(SafeCompactingHeap::slabAlignment));
+			slabReference.storagePointer = nullptr;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="handle"></param>
+		/// <returns>SafeHandleEntry&amp;</returns>
+		/// <exception cref="SafeContextException"/>
+		inline SafeHandleEntry& referToEntry(const SafeHandle<GenericType>& handle)
+		{
+			if ((handle.heapPointer != this) || (handle.entryIndex >= (this->entries).size()) || ((this->entries)[handle.entryIndex].generation != handle.generation) || ((this->entries)[handle.entryIndex].instancePointer == nullptr))
+			{
+				throw SafeContextException("Argument `handle` doesn't refer to a live instance of this heap!");
+			}
+
+			return (this->entries)[handle.entryIndex];
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeCompactingHeap`.
+		/// </summary>
+		/// <param name="slabCapacity"></param>
+		inline explicit SafeCompactingHeap(const std::size_t& slabCapacity = 0) : entries(),freeEntryIndex(SafeCompactingHeap::invalidIndex),slabs(),partialSlabIndex(0),slabCapacity(slabCapacity),liveCount(0)
+		{
+			if (this->slabCapacity == 0)
+			{
+				this->slabCapacity = ((sizeof(GenericType) >= SafeCompactingHeap::defaultSlabSize) ? 1 : (SafeCompactingHeap::defaultSlabSize / sizeof(GenericType)));
+			}
+		};
+
+	private:
+		/// <summary>
+		///		Copy constructor of `SafeCompactingHeap`.
+		/// </summary>
+		inline SafeCompactingHeap(const SafeCompactingHeap&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeCompactingHeap`.
+		/// </summary>
+		inline SafeCompactingHeap(SafeCompactingHeap&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeCompactingHeap`.
+		/// </summary>
+		inline ~SafeCompactingHeap()
+		{
+			for (std::unique_ptr<SafeSlab>& slab : this->slabs)
+			{
+				std::size_t i = 0;
+
+				for (i = 0;i < this->slabCapacity;i++)
+				{
+					if ((slab->entryIndices)[i] != SafeCompactingHeap::invalidIndex)
+					{
+						this->referToSlot(*slab,static_cast<std::uint32_t>(i))->~GenericType();
+					}
+				}
+
+				this->releaseSlab(*slab);
+			}
+		};
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeCompactingHeap&amp;</returns>
+		inline SafeCompactingHeap& operator=(const SafeCompactingHeap&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeCompactingHeap&amp;</returns>
+		inline SafeCompactingHeap& operator=(SafeCompactingHeap&&) = delete;
+
+	public:
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypesOfArguments"></typeparam>
+		/// <param name="arguments"></param>
+		/// <returns>SafeHandle&lt;GenericType&gt;</returns>
+		/// <exception cref="SafeContextException"/>
+		template<typename... GenericTypesOfArguments> inline SafeHandle<GenericType> create(GenericTypesOfArguments&&... arguments)
+		{
+			if ((this->freeEntryIndex == SafeCompactingHeap::invalidIndex) && ((this->entries).size() >= static_cast<std::size_t>(SafeCompactingHeap::invalidIndex)))
+			{
+				throw SafeContextException("The heap can't hold more handles!");
+			}
+
+			SafeSlab& slab = this->referToPartialSlab();
+			std::uint32_t slotIndex = (slab.freeSlotIndices).back();
+			GenericType* instancePointer = this->referToSlot(slab,slotIndex);
+			std::uint32_t entryIndex = this->freeEntryIndex;
+
+			if (entryIndex == SafeCompactingHeap::invalidIndex)
+			{
+				(this->entries).push_back(SafeHandleEntry{nullptr,nullptr,0,0,SafeCompactingHeap::invalidIndex});
+				entryIndex = static_cast<std::uint32_t>((this->entries).size() - 1);
+			}
+			else
+			{
+				this->freeEntryIndex = (this->entries)[entryIndex].nextFreeEntryIndex;
+			}
+
+			try
+			{
+				::new(static_cast<void*>(instancePointer)) GenericType(static_cast<GenericTypesOfArguments&&>(arguments)...);
+			}
+			catch (...)
+			{
+				(this->entries)[entryIndex].nextFreeEntryIndex = this->freeEntryIndex;
+				this->freeEntryIndex = entryIndex;
+
+				throw;
+			}
+
+			SafeHandleEntry& entry = (this->entries)[entryIndex];
+
+			(slab.freeSlotIndices).pop_back();
+			(slab.entryIndices)[slotIndex] = entryIndex;
+			(slab.liveCount)++;
+			entry.instancePointer = instancePointer;
+			entry.slabPointer = std::addressof(slab);
+			entry.slotIndex = slotIndex;
+			(this->liveCount)++;
+
+			return SafeHandle<GenericType>(this,entryIndex,entry.generation);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="handle"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		inline void release(const SafeHandle<GenericType>& handle)
+		{
+			SafeHandleEntry& entry = this->referToEntry(handle);
+			SafeSlab& slab = *(entry.slabPointer);
+
+			entry.instancePointer->~GenericType();
+			(slab.entryIndices)[entry.slotIndex] = SafeCompactingHeap::invalidIndex;
+			(slab.freeSlotIndices).push_back(entry.slotIndex);
+			(slab.liveCount)--;
+			this->partialSlabIndex = std::min(this->partialSlabIndex,slab.slabIndex);
+			entry.instancePointer = nullptr;
+			entry.slabPointer = nullptr;
+			(entry.generation)++;
+			entry.nextFreeEntryIndex = this->freeEntryIndex;
+			this->freeEntryIndex = handle.entryIndex;
+			(this->liveCount)--;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="handle"></param>
+		/// <returns>GenericType*</returns>
+		inline GenericType* resolve(const SafeHandle<GenericType>& handle) const noexcept
+		{
+			if ((handle.heapPointer != this) || (handle.entryIndex >= (this->entries).size()) || ((this->entries)[handle.entryIndex].generation != handle.generation))
+			{
+				return nullptr;
+			}
+
+			return (this->entries)[handle.entryIndex].instancePointer;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>size_t</returns>
+		inline std::size_t compact()
+		{
+			std::vector<std::unique_ptr<SafeSlab>> orderedSlabs = static_cast<std::vector<std::unique_ptr<SafeSlab>>&&>(this->slabs);
+			std::size_t movedCount = 0;
+			std::size_t targetIndex = 0;
+			std::size_t sourceIndex = 0;
+			std::size_t sourceSlotIndex = this->slabCapacity;
+			std::size_t i = 0;
+
+			this->slabs = std::vector<std::unique_ptr<SafeSlab>>();
+			std::stable_sort(orderedSlabs.begin(),orderedSlabs.end(),[](const std::unique_ptr<SafeSlab>& firstSlab,const std::unique_ptr<SafeSlab>& secondSlab) -> bool
+			{
+				return (firstSlab->liveCount > secondSlab->liveCount);
+			});
+			sourceIndex = ((orderedSlabs.empty() == true) ? 0 : (orderedSlabs.size() - 1));
+
+			try
+			{
+				while (targetIndex < sourceIndex)
+				{
+					SafeSlab& targetSlab = *(orderedSlabs[targetIndex]);
+					SafeSlab& sourceSlab = *(orderedSlabs[sourceIndex]);
+
+					if ((targetSlab.freeSlotIndices).empty() == true)
+					{
+						targetIndex++;
+
+						continue;
+					}
+
+					if (sourceSlab.liveCount == 0)
+					{
+						sourceIndex--;
+						sourceSlotIndex = this->slabCapacity;
+
+						continue;
+					}
+
+					do
+					{
+						sourceSlotIndex--;
+					}
+					while ((sourceSlab.entryIndices)[sourceSlotIndex] == SafeCompactingHeap::invalidIndex);
+
+					std::uint32_t targetSlotIndex = (targetSlab.freeSlotIndices).back();
+					std::uint32_t entryIndex = (sourceSlab.entryIndices)[sourceSlotIndex];
+					GenericType* targetPointer = this->referToSlot(targetSlab,targetSlotIndex);
+					SafeHandleEntry& entry = (this->entries)[entryIndex];
+
+					SafeRelocationHook<GenericType>::relocate(targetPointer,*(entry.instancePointer));
+					(targetSlab.freeSlotIndices).pop_back();
+					(targetSlab.entryIndices)[targetSlotIndex] = entryIndex;
+					(targetSlab.liveCount)++;
+					(sourceSlab.entryIndices)[sourceSlotIndex] = SafeCompactingHeap::invalidIndex;
+					(sourceSlab.freeSlotIndices).push_back(static_cast<std::uint32_t>(sourceSlotIndex));
+					(sourceSlab.liveCount)--;
+					entry.instancePointer = targetPointer;
+					entry.slabPointer = std::addressof(targetSlab);
+					entry.slotIndex = targetSlotIndex;
+					movedCount++;
+				}
+			}
+			catch (...)
+			{
+				this->slabs = static_cast<std::vector<std::unique_ptr<SafeSlab>>&&>(orderedSlabs);
+
+				for (i = 0;i < (this->slabs).size();i++)
+				{
+					((this->slabs)[i])->slabIndex = i;
+				}
+
+				this->partialSlabIndex = 0;
+
+				throw;
+			}
+
+			for (i = 0;i < orderedSlabs.size();i++)
+			{
+				if (orderedSlabs[i]->liveCount == 0)
+				{
+					this->releaseSlab(*(orderedSlabs[i]));
+				}
+				else
+				{
+					orderedSlabs[i]->slabIndex = (this->slabs).size();
+					(this->slabs).push_back(static_cast<std::unique_ptr<SafeSlab>&&>(orderedSlabs[i]));
+				}
+			}
+
+			this->partialSlabIndex = 0;
+
+			return movedCount;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfFunction"></typeparam>
+		/// <param name="function"></param>
+		/// <returns>void</returns>
+		template<typename GenericTypeOfFunction> inline void forEach(GenericTypeOfFunction&& function)
+		{
+			for (std::unique_ptr<SafeSlab>& slab : this->slabs)
+			{
+				std::size_t i = 0;
+
+				for (i = 0;i < this->slabCapacity;i++)
+				{
+					if ((slab->entryIndices)[i] != SafeCompactingHeap::invalidIndex)
+					{
+						function(*(this->referToSlot(*slab,static_cast<std::uint32_t>(i))));
+					}
+				}
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getLiveCount() const noexcept
+		{
+			return this->liveCount;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getSlabCount() const noexcept
+		{
+			return (this->slabs).size();
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getSlabCapacity() const noexcept
+		{
+			return this->slabCapacity;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getReservedSize() const noexcept
+		{
+			return (this->slabs).size() * this->slabCapacity * sizeof(GenericType);
+		};
+	};
+
+	/// <summary>
+	///		dynamic
+	///		inline
+	///		noexcept
+	/// </summary>
+	/// <returns>GenericType*</returns>
+	template<typename GenericType> inline GenericType* SafeHandle<GenericType>::get() const noexcept
+	{
+		return ((this->heapPointer == nullptr) ? nullptr : (this->heapPointer)->resolve(*this));
+	};
+};
\ No newline at end of file
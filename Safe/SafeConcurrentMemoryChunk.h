@@ -0,0 +1,298 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeAlignment.h"
+#include "SafeContextBase.h"
+#include "SafeContextException.h"
+#include "SafeMemoryChunk.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class template: `SafeConcurrentMemoryChunk`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> class SafeConcurrentMemoryChunk final : public SafeContextBase
+	{
+	private:
+		/// <summary>
+		///		C++ structure: `SafeSequenceStripe`.
+		/// </summary>
+		struct alignas(SafeCacheLineAlignment::alignment) SafeSequenceStripe
+		{
+			std::atomic<std::uint64_t> sequence;
+		};
+
+		std::size_t cardinality;
+		std::size_t stripeMask;
+		std::unique_ptr<SafeSequenceStripe[]> stripes;
+		SafeContextBase::SafeMemoryChunk<GenericTypeOfSafeContextDerivative> elementChunk;
+
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="cardinality"></param>
+		/// <param name="stripeCount"></param>
+		/// <returns>size_t</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline std::size_t roundStripeCount(const std::size_t& cardinality,const std::size_t& stripeCount)
+		{
+			std::size_t boundedStripeCount = ((stripeCount < cardinality) ? stripeCount : cardinality);
+			std::size_t roundedStripeCount = 1;
+
+			if (stripeCount == 0)
+			{
+				throw SafeContextException("Argument `stripeCount` must be positive!");
+			}
+
+			if (boundedStripeCount > ((std::numeric_limits<std::size_t>::max() >> 1) + 1))
+			{
+				throw SafeContextException("Argument `stripeCount` is too large: `" + std::to_string(stripeCount) + "`!");
+			}
+
+			while (roundedStripeCount < boundedStripeCount)
+			{
+				roundedStripeCount <<= 1;
+			}
+
+			return roundedStripeCount;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="index"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		inline void checkIndex(const std::size_t& index) const
+		{
+			if (index >= this->cardinality)
+			{
+				throw SafeContextException("Argument `index` is out of bound: `" + std::to_string(index) + "` while the cardinality is `" + std::to_string(this->cardinality) + "`!");
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="index"></param>
+		/// <returns>atomic&lt;uint64_t&gt;&amp;</returns>
+		inline std::atomic<std::uint64_t>& referToSequence(const std::size_t& index) const noexcept
+		{
+			return ((this->stripes)[index & this->stripeMask]).sequence;
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeConcurrentMemoryChunk`.
+		/// </summary>
+		/// <param name="cardinality"></param>
+		/// <param name="stripeCount"></param>
+		/// <exception cref="SafeContextException"/>
+		inline explicit SafeConcurrentMemoryChunk(const std::size_t& cardinality,const std::size_t& stripeCount = 64) : SafeContextBase(),cardinality(cardinality),stripeMask(SafeConcurrentMemoryChunk::roundStripeCount(cardinality,stripeCount) - 1),stripes(::new SafeSequenceStripe[SafeConcurrentMemoryChunk::roundStripeCount(cardinality,stripeCount)]),elementChunk(cardinality)
+		{
+			std::size_t i = 0;
+
+			for (i = 0;i <= this->stripeMask;i++)
+			{
+				((this->stripes)[i]).sequence.store(0,std::memory_order_relaxed);
+			}
+		};
+
+	private:
+		/// <summary>
+		///		Copy constructor of `SafeConcurrentMemoryChunk`.
+		/// </summary>
+		inline SafeConcurrentMemoryChunk(const SafeConcurrentMemoryChunk&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeConcurrentMemoryChunk`.
+		/// </summary>
+		inline SafeConcurrentMemoryChunk(SafeConcurrentMemoryChunk&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeConcurrentMemoryChunk`.
+		/// </summary>
+		inline virtual ~SafeConcurrentMemoryChunk() noexcept(false) override = default;
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeConcurrentMemoryChunk&amp;</returns>
+		inline SafeConcurrentMemoryChunk& operator=(const SafeConcurrentMemoryChunk&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeConcurrentMemoryChunk&amp;</returns>
+		inline SafeConcurrentMemoryChunk& operator=(SafeConcurrentMemoryChunk&&) = delete;
+
+	public:
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSnapshot"></typeparam>
+		/// <param name="index"></param>
+		/// <param name="snapshotMember"></param>
+		/// <returns>GenericTypeOfSnapshot</returns>
+		/// <exception cref="SafeContextException"/>
+		template<typename GenericTypeOfSnapshot> inline GenericTypeOfSnapshot read(const std::size_t& index,GenericTypeOfSnapshot GenericTypeOfSafeContextDerivative::* const snapshotMember) const
+		{
+			static_assert((std::is_trivially_copyable<GenericTypeOfSnapshot>::value == true),"`GenericTypeOfSnapshot` must be a trivially copyable type!");
+			static_assert((std::is_default_constructible<GenericTypeOfSnapshot>::value == true),"`GenericTypeOfSnapshot` must be a type having a default constructor!");
+
+			this->checkIndex(index);
+
+			std::atomic<std::uint64_t>& sequence = this->referToSequence(index);
+			const GenericTypeOfSnapshot& memberReference = ((this->elementChunk)[index]).*snapshotMember;
+			GenericTypeOfSnapshot snapshot;
+
+			while (true)
+			{
+				std::uint64_t startingSequence = sequence.load(std::memory_order_acquire);
+
+				if ((startingSequence & 1) != 0)
+				{
+					std::this_thread::yield();
+
+					continue;
+				}
+
+				std::memcpy(static_cast<void*>(std::addressof(snapshot)),static_cast<const void*>(std::addressof(memberReference)),sizeof(GenericTypeOfSnapshot));
+				std::atomic_thread_fence(std::memory_order_acquire);
+
+				if (sequence.load(std::memory_order_relaxed) == startingSequence)
+				{
+					return snapshot;
+				}
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSnapshot"></typeparam>
+		/// <typeparam name="GenericTypeOfFunction"></typeparam>
+		/// <param name="index"></param>
+		/// <param name="snapshotMember"></param>
+		/// <param name="function"></param>
+		/// <returns>decltype(function(const GenericTypeOfSnapshot&amp;))</returns>
+		/// <exception cref="SafeContextException"/>
+		template<typename GenericTypeOfSnapshot,typename GenericTypeOfFunction> inline auto read(const std::size_t& index,GenericTypeOfSnapshot GenericTypeOfSafeContextDerivative::* const snapshotMember,GenericTypeOfFunction&& function) const -> decltype(function(std::declval<const GenericTypeOfSnapshot&>()))
+		{
+			const GenericTypeOfSnapshot snapshot = this->read(index,snapshotMember);
+
+			return function(snapshot);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfFunction"></typeparam>
+		/// <param name="index"></param>
+		/// <param name="function"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		template<typename GenericTypeOfFunction> inline void write(const std::size_t& index,GenericTypeOfFunction&& function)
+		{
+			this->checkIndex(index);
+
+			std::atomic<std::uint64_t>& sequence = this->referToSequence(index);
+			GenericTypeOfSafeContextDerivative& elementReference = (this->elementChunk)[index];
+			std::uint64_t startingSequence = sequence.load(std::memory_order_relaxed);
+
+			while (((startingSequence & 1) != 0) || (sequence.compare_exchange_weak(startingSequence,startingSequence + 1,std::memory_order_acquire,std::memory_order_relaxed) == false))
+			{
+				if ((startingSequence & 1) != 0)
+				{
+					std::this_thread::yield();
+					startingSequence = sequence.load(std::memory_order_relaxed);
+				}
+			}
+
+			std::atomic_thread_fence(std::memory_order_release);
+
+			try
+			{
+				function(elementReference);
+			}
+			catch (...)
+			{
+				sequence.store(startingSequence + 2,std::memory_order_release);
+
+				throw;
+			}
+
+			sequence.store(startingSequence + 2,std::memory_order_release);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getCardinality() const noexcept
+		{
+			return this->cardinality;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getStripeCount() const noexcept
+		{
+			return this->stripeMask + 1;
+		};
+	};
+};
\ No newline at end of file
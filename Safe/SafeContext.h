@@ -0,0 +1,213 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <type_traits>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextBase.h"
+#include "SafeContextStatistics.h"
+#include "SafeLifetimeReport.h"
+#include "SafeLiveDirectory.h"
+#include "SafeTraits.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class template: `SafeContext`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> class SafeContext : public SafeContextBase
+	{
+	private:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>SafeTypeStatistics&amp;</returns>
+		static inline SafeTypeStatistics& referToLifetimeStatistics()
+		{
+			static SafeTypeStatistics& statisticsReference = SafeContextStatistics::referToTypeStatistics<GenericTypeOfSafeContextDerivative>();
+			static const bool initialization = SafeLifetimeReport::initializeFromEnvironment();
+
+			static_cast<void>(initialization);
+
+			return statisticsReference;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="instancePointer"></param>
+		/// <returns>void</returns>
+		static inline void recordConstruction(const void* const instancePointer)
+		{
+			SafeTypeStatistics& statisticsReference = SafeContext::referToLifetimeStatistics();
+
+			statisticsReference.recordConstruction();
+			SafeLifetimeSampler::sample(instancePointer,statisticsReference);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		inline void enlistLiveInstance()
+		{
+			if constexpr (SafeLiveEnumerable<GenericTypeOfSafeContextDerivative>::value == true)
+			{
+				SafeLiveDirectory<GenericTypeOfSafeContextDerivative>::referToDirectory().enlist(static_cast<const void*>(this),static_cast<GenericTypeOfSafeContextDerivative*>(this));
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		inline void delistLiveInstance() noexcept
+		{
+			if constexpr (SafeLiveEnumerable<GenericTypeOfSafeContextDerivative>::value == true)
+			{
+				SafeLiveDirectory<GenericTypeOfSafeContextDerivative>::referToDirectory().delist(static_cast<const void*>(this));
+			}
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeContext`.
+		/// </summary>
+		inline explicit SafeContext() : SafeContextBase()
+		{
+			static_assert((std::is_base_of<SafeContext<GenericTypeOfSafeContextDerivative>,GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be the type inheriting `SafeContext<GenericTypeOfSafeContextDerivative>`!");
+
+			SafeContext::recordConstruction(static_cast<const void*>(this));
+			this->enlistLiveInstance();
+		};
+
+		/// <summary>
+		///		Copy constructor of `SafeContext`.
+		/// </summary>
+		/// <param name="other"></param>
+		inline SafeContext(const SafeContext<GenericTypeOfSafeContextDerivative>& other) noexcept(false) : SafeContextBase(static_cast<const SafeContextBase&>(other))
+		{
+			SafeContext::recordConstruction(static_cast<const void*>(this));
+			this->enlistLiveInstance();
+		};
+
+		/// <summary>
+		///		Move constructor of `SafeContext`.
+		/// </summary>
+		/// <param name="other"></param>
+		inline SafeContext(SafeContext<GenericTypeOfSafeContextDerivative>&& other) noexcept(false) : SafeContextBase(static_cast<SafeContextBase&&>(other))
+		{
+			SafeContext::recordConstruction(static_cast<const void*>(this));
+			this->enlistLiveInstance();
+		};
+
+		/// <summary>
+		///		Destructor of `SafeContext`.
+		/// </summary>
+		inline virtual ~SafeContext() noexcept(false) override
+		{
+			SafeContext::referToLifetimeStatistics().recordDestruction();
+			SafeLifetimeSampler::release(static_cast<const void*>(this));
+			this->delistLiveInstance();
+		};
+
+	protected:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		///		operator=
+		/// </summary>
+		/// <param name="other"></param>
+		/// <returns>SafeContext&lt;GenericTypeOfSafeContextDerivative&gt;&amp;</returns>
+		inline SafeContext<GenericTypeOfSafeContextDerivative>& operator=(const SafeContext<GenericTypeOfSafeContextDerivative>& other) noexcept
+		{
+			SafeContextBase::operator=(static_cast<const SafeContextBase&>(other));
+
+			return *this;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		///		operator=
+		/// </summary>
+		/// <param name="other"></param>
+		/// <returns>SafeContext&lt;GenericTypeOfSafeContextDerivative&gt;&amp;</returns>
+		inline SafeContext<GenericTypeOfSafeContextDerivative>& operator=(SafeContext<GenericTypeOfSafeContextDerivative>&& other) noexcept
+		{
+			SafeContextBase::operator=(static_cast<SafeContextBase&&>(other));
+
+			return *this;
+		};
+
+	public:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		///		operator&amp;
+		/// </summary>
+		/// <returns>GenericTypeOfSafeContextDerivative*</returns>
+		inline GenericTypeOfSafeContextDerivative* operator&() & noexcept
+		{
+			return static_cast<GenericTypeOfSafeContextDerivative*>(this);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		///		operator&amp;
+		/// </summary>
+		/// <returns>GenericTypeOfSafeContextDerivative*</returns>
+		inline const GenericTypeOfSafeContextDerivative* operator&() const & noexcept
+		{
+			return static_cast<const GenericTypeOfSafeContextDerivative*>(this);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		inline std::size_t getMemorySize() const & noexcept
+		{
+			return sizeof(GenericTypeOfSafeContextDerivative);
+		};
+	};
+};
\ No newline at end of file
@@ -20,13 +20,21 @@
 #pragma once
 
 /** Inclusion(s) of C++ standard library header file(s).**/
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <thread>
 #include <type_traits>
 #include <typeinfo>
 #include <vector>
 
 /** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeAlignment.h"
+#include "SafeContextStatistics.h"
 #include "SafeNamespace.h"
 #include "SafeTrade.h"
+#include "SafeTrace.h"
 
 
 /** Main code.**/
@@ -47,6 +55,12 @@ namespace Safe
 		/// </summary>
 		class SafeMemoryManager;
 
+		/// <summary>
+		///		C++ class: `SafeImagePrototype`.
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		template<typename GenericTypeOfSafeContextDerivative> class SafeImagePrototype;
+
 		/// <summary>
 		///		C++ functional pointer type: `SafeConstructionInvoker`.
 		/// </summary>
@@ -62,6 +76,17 @@ namespace Safe
 		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
 		template<typename GenericTypeOfSafeContextDerivative> class SafeMemoryChunk;
 
+		/// <summary>
+		///		C++ class: `SafeMappedMemoryChunk`.
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		template<typename GenericTypeOfSafeContextDerivative> class SafeMappedMemoryChunk;
+
+		/// <summary>
+		///		C++ class: `EpochGuard`.
+		/// </summary>
+		class EpochGuard;
+
 		/// <summary>
 		///		Constructor of `SafeContextBase`.
 		/// </summary>
@@ -110,6 +135,34 @@ namespace Safe
 		/// <returns>void</returns>
 		static void operator delete(void* const memoryPointer) noexcept;
 
+		/// <summary>
+		///		static
+		///		inline
+		///		operator new()
+		/// </summary>
+		/// <typeparam name="GenericType"></typeparam>
+		/// <param name="memorySize"></param>
+		/// <param name="memoryAlignment"></param>
+		/// <returns>void*</returns>
+		template<typename GenericType = void> [[noreturn]] static inline void* operator new(std::size_t memorySize,std::align_val_t memoryAlignment)
+		{
+			static_assert((std::is_void<GenericType>::value == false),"An over-aligned type inherited from `SafeContextBase` can't be allocated on the memory heap, use a memory chunk instead!");
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		///		operator delete()
+		/// </summary>
+		/// <param name="memoryPointer"></param>
+		/// <param name="memoryAlignment"></param>
+		/// <returns>void</returns>
+		static inline void operator delete(void* const memoryPointer,std::align_val_t memoryAlignment) noexcept
+		{
+			::operator delete(memoryPointer,memoryAlignment);
+		};
+
 	private:
 		/// <summary>
 		///		static
@@ -240,6 +293,47 @@ namespace Safe
 			return defaultInstancePointer;
 		};
 
+		/// <summary>
+		///		C++ structure template: `SafeProxyInstancePair`.
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		template<typename GenericTypeOfSafeContextDerivative> struct SafeProxyInstancePair
+		{
+			const GenericTypeOfSafeContextDerivative* constantProxyInstancePointer;
+			GenericTypeOfSafeContextDerivative* variableProxyInstancePointer;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		/// <returns>SafeProxyInstancePair&lt;GenericTypeOfSafeContextDerivative&gt;</returns>
+		template<typename GenericTypeOfSafeContextDerivative> static inline SafeProxyInstancePair<GenericTypeOfSafeContextDerivative> composeProxyInstancesOfDerivedType()
+		{
+			const GenericTypeOfSafeContextDerivative* constantProxyInstancePointer = static_cast<const GenericTypeOfSafeContextDerivative*>(SafeContextBase::referToDefaultConstantInstance(typeid(GenericTypeOfSafeContextDerivative)));
+
+			if (constantProxyInstancePointer == nullptr)
+			{
+				constantProxyInstancePointer = SafeContextBase::supplementDefaultInstanceOfDerivedType<GenericTypeOfSafeContextDerivative>();
+			}
+
+			return SafeProxyInstancePair<GenericTypeOfSafeContextDerivative>{constantProxyInstancePointer,::new GenericTypeOfSafeContextDerivative()};
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		/// <returns>SafeProxyInstancePair&lt;GenericTypeOfSafeContextDerivative&gt;&amp;</returns>
+		template<typename GenericTypeOfSafeContextDerivative> static inline const SafeProxyInstancePair<GenericTypeOfSafeContextDerivative>& referToProxyInstancesOfDerivedType()
+		{
+			static const SafeProxyInstancePair<GenericTypeOfSafeContextDerivative> proxyInstancePair = SafeContextBase::composeProxyInstancesOfDerivedType<GenericTypeOfSafeContextDerivative>();
+
+			return proxyInstancePair;
+		};
+
 		/// <summary>
 		///		static
 		/// </summary>
@@ -311,6 +405,95 @@ namespace Safe
 		/// <returns>void</returns>
 		static void recycle(SafeContextBase* const instancePointer);
 
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		/// <param name="reservedCount"></param>
+		/// <param name="parallelism"></param>
+		/// <returns>size_t</returns>
+		/// <exception cref="SafeContextException"/>
+		template<typename GenericTypeOfSafeContextDerivative> static inline std::size_t reserve(const std::size_t& reservedCount,const std::size_t& parallelism = 1)
+		{
+			static_assert((std::is_base_of<SafeContextBase,GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type inherited from `SafeContextBase`!");
+			static_assert((std::is_default_constructible<GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type having a default constructor!");
+			static_assert((std::is_pointer<GenericTypeOfSafeContextDerivative>::value == false),"`GenericTypeOfSafeContextDerivative` can't be a pointer type!");
+			static_assert((SafeAlignedLayout<GenericTypeOfSafeContextDerivative>::alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__),"`GenericTypeOfSafeContextDerivative` can't be over-aligned on the memory heap, use a memory chunk instead!");
+
+			std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			std::size_t workerCount = ((parallelism == 0) ? 1 : ((parallelism > reservedCount) ? reservedCount : parallelism));
+			std::vector<std::exception_ptr> workerExceptions = std::vector<std::exception_ptr>(workerCount);
+			std::vector<std::thread> workers = std::vector<std::thread>();
+			std::size_t i = 0;
+
+			auto reserveShare = [&workerExceptions](const std::size_t& workerIndex,const std::size_t& shareCount) -> void
+			{
+				std::vector<GenericTypeOfSafeContextDerivative*> instancePointers = std::vector<GenericTypeOfSafeContextDerivative*>();
+				std::size_t j = 0;
+
+				try
+				{
+					instancePointers.reserve(shareCount);
+
+					for (j = 0;j < shareCount;j++)
+					{
+						instancePointers.push_back(new GenericTypeOfSafeContextDerivative());
+					}
+				}
+				catch (...)
+				{
+					workerExceptions[workerIndex] = std::current_exception();
+				}
+
+				for (j = 0;j < instancePointers.size();j++)
+				{
+					SafeContextBase::recycle(instancePointers[j]);
+				}
+			};
+
+			try
+			{
+				workers.reserve(workerCount);
+
+				for (i = 1;i < workerCount;i++)
+				{
+					workers.emplace_back(reserveShare,i,(reservedCount / workerCount) + ((i < (reservedCount % workerCount)) ? 1 : 0));
+				}
+			}
+			catch (...)
+			{
+				for (i = 0;i < workers.size();i++)
+				{
+					workers[i].join();
+				}
+
+				throw;
+			}
+
+			if (workerCount > 0)
+			{
+				reserveShare(0,(reservedCount / workerCount) + ((reservedCount % workerCount) > 0 ? 1 : 0));
+			}
+
+			for (i = 0;i < workers.size();i++)
+			{
+				workers[i].join();
+			}
+
+			SafeContextStatistics::referToTypeStatistics<GenericTypeOfSafeContextDerivative>().recordWarmUp(reservedCount,std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime));
+
+			for (i = 0;i < workerExceptions.size();i++)
+			{
+				if (workerExceptions[i] != nullptr)
+				{
+					std::rethrow_exception(workerExceptions[i]);
+				}
+			}
+
+			return reservedCount;
+		};
+
 		/// <summary>
 		///		static
 		///		inline
@@ -322,6 +505,7 @@ namespace Safe
 			static_assert((std::is_base_of<SafeContextBase,GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type inherited from `SafeContextBase`!");
 			static_assert((std::is_default_constructible<GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type having a default constructor!");
 			static_assert((std::is_pointer<GenericTypeOfSafeContextDerivative>::value == false),"`GenericTypeOfSafeContextDerivative` can't be a pointer type!");
+			static_assert((SafeAlignedLayout<GenericTypeOfSafeContextDerivative>::alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__),"`GenericTypeOfSafeContextDerivative` can't be over-aligned on the memory heap, use a memory chunk instead!");
 
 			GenericTypeOfSafeContextDerivative* recycledPointer = static_cast<GenericTypeOfSafeContextDerivative*>(SafeContextBase::upcycle(typeid(GenericTypeOfSafeContextDerivative)));
 
@@ -331,12 +515,19 @@ namespace Safe
 				{
 					::new(instancePointer) GenericTypeOfSafeContextDerivative();
 				});
+				SafeContextStatistics::referToTypeStatistics<GenericTypeOfSafeContextDerivative>().recordRepurposeHit();
+				CPP_SAFE_TRACE(repurpose_hit,reinterpret_cast<std::uintptr_t>(static_cast<void*>(recycledPointer)),sizeof(GenericTypeOfSafeContextDerivative));
 
 				return *recycledPointer;
 			}
 			else
 			{
-				return *(new GenericTypeOfSafeContextDerivative());
+				GenericTypeOfSafeContextDerivative* constructedPointer = new GenericTypeOfSafeContextDerivative();
+
+				SafeContextStatistics::referToTypeStatistics<GenericTypeOfSafeContextDerivative>().recordRepurposeMiss();
+				CPP_SAFE_TRACE(repurpose_miss,reinterpret_cast<std::uintptr_t>(static_cast<void*>(constructedPointer)),sizeof(GenericTypeOfSafeContextDerivative));
+
+				return *constructedPointer;
 			}
 		};
 
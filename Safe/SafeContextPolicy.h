@@ -0,0 +1,617 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeArrayBins.h"
+#include "SafeContextBase.h"
+#include "SafeRegion.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ structure template: `SafeContextPolicy`.
+	/// </summary>
+	/// <typeparam name="GenericTracking"></typeparam>
+	/// <typeparam name="GenericRecycling"></typeparam>
+	/// <typeparam name="GenericPolymorphism"></typeparam>
+	template<bool GenericTracking,bool GenericRecycling,bool GenericPolymorphism> struct SafeContextPolicy
+	{
+		static_assert((GenericTracking == false) || ((GenericRecycling == true) && (GenericPolymorphism == true)),"A tracked policy always recycles and is always polymorphic!");
+
+
+		static constexpr bool tracking = GenericTracking;
+		static constexpr bool recycling = GenericRecycling;
+		static constexpr bool polymorphism = GenericPolymorphism;
+	};
+
+	/// <summary>
+	///		C++ type name alias: `SafeTrackedPolicy`.
+	/// </summary>
+	using SafeTrackedPolicy = SafeContextPolicy<true,true,true>;
+
+	/// <summary>
+	///		C++ type name alias: `SafeValuePolicy`.
+	/// </summary>
+	using SafeValuePolicy = SafeContextPolicy<false,false,false>;
+
+	/// <summary>
+	///		C++ type name alias: `SafePooledValuePolicy`.
+	/// </summary>
+	using SafePooledValuePolicy = SafeContextPolicy<false,true,false>;
+
+	/// <summary>
+	///		C++ type name alias: `SafePolymorphicValuePolicy`.
+	/// </summary>
+	using SafePolymorphicValuePolicy = SafeContextPolicy<false,false,true>;
+
+	/// <summary>
+	///		C++ class template: `SafeUntrackedRecycler`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfUntrackedDerivative"></typeparam>
+	template<typename GenericTypeOfUntrackedDerivative> class SafeUntrackedRecycler final
+	{
+	private:
+		/// <summary>
+		///		C++ structure: `SafeReturnStack`.
+		/// </summary>
+		struct SafeReturnStack
+		{
+			std::atomic<void*> headBlockPointer;
+			SafeReturnStack* nextAbandonedStackPointer;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeAbandonment`.
+		/// </summary>
+		struct SafeAbandonment
+		{
+			std::mutex abandonmentMutex;
+			SafeReturnStack* headStackPointer = nullptr;
+		};
+
+		static constexpr std::size_t blockSize = ((sizeof(GenericTypeOfUntrackedDerivative) > sizeof(void*)) ? sizeof(GenericTypeOfUntrackedDerivative) : sizeof(void*));
+		static constexpr std::size_t blockAlignment = ((alignof(GenericTypeOfUntrackedDerivative) > alignof(void*)) ? alignof(GenericTypeOfUntrackedDerivative) : alignof(void*));
+		static constexpr std::size_t headerSize = ((sizeof(void*) + blockAlignment - 1) / blockAlignment) * blockAlignment;
+		static constexpr std::size_t cachedCapacity = 4096;
+
+		void* headBlockPointer;
+		std::size_t cachedCount;
+		SafeReturnStack* returnStackPointer;
+
+
+		/// <summary>
+		///		Constructor of `SafeUntrackedRecycler`.
+		/// </summary>
+		inline explicit SafeUntrackedRecycler() noexcept : headBlockPointer(nullptr),cachedCount(0),returnStackPointer(nullptr)
+		{
+
+		};
+
+		/// <summary>
+		///		Copy constructor of `SafeUntrackedRecycler`.
+		/// </summary>
+		inline SafeUntrackedRecycler(const SafeUntrackedRecycler&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeUntrackedRecycler`.
+		/// </summary>
+		inline SafeUntrackedRecycler(SafeUntrackedRecycler&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeUntrackedRecycler`.
+		/// </summary>
+		inline ~SafeUntrackedRecycler()
+		{
+			while (this->headBlockPointer != nullptr)
+			{
+				void* nextBlockPointer = *static_cast<void**>(this->headBlockPointer);
+
+				SafeUntrackedRecycler::releaseBlock(this->headBlockPointer);
+				this->headBlockPointer = nextBlockPointer;
+			}
+
+			if (this->returnStackPointer != nullptr)
+			{
+				void* returnedBlockPointer = (this->returnStackPointer)->headBlockPointer.exchange(nullptr,std::memory_order_acquire);
+				SafeAbandonment& abandonment = SafeUntrackedRecycler::referToAbandonment();
+
+				while (returnedBlockPointer != nullptr)
+				{
+					void* nextBlockPointer = *static_cast<void**>(returnedBlockPointer);
+
+					SafeUntrackedRecycler::releaseBlock(returnedBlockPointer);
+					returnedBlockPointer = nextBlockPointer;
+				}
+
+				std::lock_guard<std::mutex> abandonmentLock(abandonment.abandonmentMutex);
+
+				(this->returnStackPointer)->nextAbandonedStackPointer = abandonment.headStackPointer;
+				abandonment.headStackPointer = this->returnStackPointer;
+			}
+		};
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeUntrackedRecycler&amp;</returns>
+		inline SafeUntrackedRecycler& operator=(const SafeUntrackedRecycler&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeUntrackedRecycler&amp;</returns>
+		inline SafeUntrackedRecycler& operator=(SafeUntrackedRecycler&&) = delete;
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>SafeUntrackedRecycler&amp;</returns>
+		static inline SafeUntrackedRecycler& referToRecycler() noexcept
+		{
+			static thread_local SafeUntrackedRecycler recycler;
+
+			return recycler;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>SafeAbandonment&amp;</returns>
+		static inline SafeAbandonment& referToAbandonment()
+		{
+			static SafeAbandonment* abandonmentPointer = new SafeAbandonment();
+
+			return *abandonmentPointer;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="blockPointer"></param>
+		/// <returns>SafeReturnStack*&amp;</returns>
+		static inline SafeReturnStack*& referToOwnerStackPointer(void* const blockPointer) noexcept
+		{
+			return *reinterpret_cast<SafeReturnStack**>(static_cast<unsigned char*>(blockPointer) - sizeof(SafeReturnStack*));
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="blockPointer"></param>
+		/// <returns>void</returns>
+		static inline void releaseBlock(void* const blockPointer) noexcept
+		{
+			::operator delete(static_cast<void*>(static_cast<unsigned char*>(blockPointer) - SafeUntrackedRecycler::headerSize),std::align_val_t(SafeUntrackedRecycler::blockAlignment));
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>SafeReturnStack*</returns>
+		inline SafeReturnStack* referToReturnStack()
+		{
+			if (this->returnStackPointer == nullptr)
+			{
+				SafeAbandonment& abandonment = SafeUntrackedRecycler::referToAbandonment();
+
+				{
+					std::lock_guard<std::mutex> abandonmentLock(abandonment.abandonmentMutex);
+
+					if (abandonment.headStackPointer != nullptr)
+					{
+						this->returnStackPointer = abandonment.headStackPointer;
+						abandonment.headStackPointer = (this->returnStackPointer)->nextAbandonedStackPointer;
+					}
+				}
+
+				if (this->returnStackPointer == nullptr)
+				{
+					this->returnStackPointer = new SafeReturnStack{{nullptr},nullptr};
+				}
+			}
+
+			return this->returnStackPointer;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		inline std::size_t reclaimReturnedBlocks() noexcept
+		{
+			std::size_t reclaimedCount = 0;
+
+			if ((this->returnStackPointer == nullptr) || ((this->returnStackPointer)->headBlockPointer.load(std::memory_order_relaxed) == nullptr))
+			{
+				return 0;
+			}
+
+			void* returnedBlockPointer = (this->returnStackPointer)->headBlockPointer.exchange(nullptr,std::memory_order_acquire);
+
+			while (returnedBlockPointer != nullptr)
+			{
+				void* nextBlockPointer = *static_cast<void**>(returnedBlockPointer);
+
+				if (this->cachedCount < SafeUntrackedRecycler::cachedCapacity)
+				{
+					*static_cast<void**>(returnedBlockPointer) = this->headBlockPointer;
+					this->headBlockPointer = returnedBlockPointer;
+					(this->cachedCount)++;
+					reclaimedCount++;
+				}
+				else
+				{
+					SafeUntrackedRecycler::releaseBlock(returnedBlockPointer);
+				}
+
+				returnedBlockPointer = nextBlockPointer;
+			}
+
+			return reclaimedCount;
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>void*</returns>
+		static inline void* upcycle()
+		{
+			SafeUntrackedRecycler& recycler = SafeUntrackedRecycler::referToRecycler();
+
+			if (recycler.headBlockPointer == nullptr)
+			{
+				recycler.referToReturnStack();
+				recycler.reclaimReturnedBlocks();
+			}
+
+			if (recycler.headBlockPointer != nullptr)
+			{
+				void* blockPointer = recycler.headBlockPointer;
+
+				recycler.headBlockPointer = *static_cast<void**>(blockPointer);
+				recycler.cachedCount--;
+
+				return blockPointer;
+			}
+
+			void* blockPointer = static_cast<void*>(static_cast<unsigned char*>(::operator new(SafeUntrackedRecycler::headerSize + SafeUntrackedRecycler::blockSize,std::align_val_t(SafeUntrackedRecycler::blockAlignment))) + SafeUntrackedRecycler::headerSize);
+
+			SafeUntrackedRecycler::referToOwnerStackPointer(blockPointer) = recycler.returnStackPointer;
+
+			return blockPointer;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="blockPointer"></param>
+		/// <returns>void</returns>
+		static inline void recycle(void* const blockPointer) noexcept
+		{
+			assert((SafeRegion::isRegionMemory(blockPointer) == false) && "A block of a region can't be recycled!");
+
+			SafeUntrackedRecycler& recycler = SafeUntrackedRecycler::referToRecycler();
+			SafeReturnStack* ownerStackPointer = SafeUntrackedRecycler::referToOwnerStackPointer(blockPointer);
+
+			if (ownerStackPointer != recycler.returnStackPointer)
+			{
+				void* headBlockPointer = ownerStackPointer->headBlockPointer.load(std::memory_order_relaxed);
+
+				do
+				{
+					*static_cast<void**>(blockPointer) = headBlockPointer;
+				}
+				while (ownerStackPointer->headBlockPointer.compare_exchange_weak(headBlockPointer,blockPointer,std::memory_order_release,std::memory_order_relaxed) == false);
+
+				return;
+			}
+
+			if (recycler.cachedCount >= SafeUntrackedRecycler::cachedCapacity)
+			{
+				SafeUntrackedRecycler::releaseBlock(blockPointer);
+
+				return;
+			}
+
+			*static_cast<void**>(blockPointer) = recycler.headBlockPointer;
+			recycler.headBlockPointer = blockPointer;
+			recycler.cachedCount++;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline std::size_t reclaim() noexcept
+		{
+			return SafeUntrackedRecycler::referToRecycler().reclaimReturnedBlocks();
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline std::size_t getCachedCount() noexcept
+		{
+			return SafeUntrackedRecycler::referToRecycler().cachedCount;
+		};
+	};
+
+	/// <summary>
+	///		C++ class template: `SafeUntrackedAllocation`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfUntrackedDerivative"></typeparam>
+	/// <typeparam name="GenericRecycling"></typeparam>
+	template<typename GenericTypeOfUntrackedDerivative,bool GenericRecycling> class SafeUntrackedAllocation
+	{
+
+	};
+
+	/// <summary>
+	///		C++ class template: `SafeUntrackedAllocation`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfUntrackedDerivative"></typeparam>
+	template<typename GenericTypeOfUntrackedDerivative> class SafeUntrackedAllocation<GenericTypeOfUntrackedDerivative,true>
+	{
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="memorySize"></param>
+		/// <returns>void*</returns>
+		static inline void* operator new(std::size_t memorySize)
+		{
+			if (memorySize != sizeof(GenericTypeOfUntrackedDerivative))
+			{
+				return ::operator new(memorySize);
+			}
+
+			void* regionMemoryPointer = SafeRegion::allocateInActiveRegion<GenericTypeOfUntrackedDerivative>();
+
+			if (regionMemoryPointer != nullptr)
+			{
+				return regionMemoryPointer;
+			}
+
+			return SafeUntrackedRecycler<GenericTypeOfUntrackedDerivative>::upcycle();
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="memoryPointer"></param>
+		/// <param name="memorySize"></param>
+		/// <returns>void</returns>
+		static inline void operator delete(void* const memoryPointer,std::size_t memorySize) noexcept
+		{
+			if (memorySize != sizeof(GenericTypeOfUntrackedDerivative))
+			{
+				::operator delete(memoryPointer);
+
+				return;
+			}
+
+			if (SafeRegion::isRegionMemory(memoryPointer) == true)
+			{
+				SafeRegion::releaseInActiveRegion<GenericTypeOfUntrackedDerivative>(memoryPointer);
+
+				return;
+			}
+
+			SafeUntrackedRecycler<GenericTypeOfUntrackedDerivative>::recycle(memoryPointer);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="memoryArraySize"></param>
+		/// <returns>void*</returns>
+		static inline void* operator new[](std::size_t memoryArraySize)
+		{
+			if (alignof(GenericTypeOfUntrackedDerivative) > alignof(std::max_align_t))
+			{
+				return ::operator new[](memoryArraySize,std::align_val_t(alignof(GenericTypeOfUntrackedDerivative)));
+			}
+
+			return SafeArrayBins::allocate(memoryArraySize);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="memoryArrayPointer"></param>
+		/// <returns>void</returns>
+		static inline void operator delete[](void* const memoryArrayPointer) noexcept
+		{
+			if (alignof(GenericTypeOfUntrackedDerivative) > alignof(std::max_align_t))
+			{
+				::operator delete[](memoryArrayPointer,std::align_val_t(alignof(GenericTypeOfUntrackedDerivative)));
+
+				return;
+			}
+
+			SafeArrayBins::deallocate(memoryArrayPointer);
+		};
+	};
+
+	/// <summary>
+	///		C++ class template: `SafeUntrackedContext`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfUntrackedDerivative"></typeparam>
+	/// <typeparam name="GenericPolicy"></typeparam>
+	/// <typeparam name="GenericPolymorphism"></typeparam>
+	template<typename GenericTypeOfUntrackedDerivative,typename GenericPolicy,bool GenericPolymorphism = GenericPolicy::polymorphism> class SafeUntrackedContext : public SafeUntrackedAllocation<GenericTypeOfUntrackedDerivative,GenericPolicy::recycling>
+	{
+		static_assert((GenericPolicy::tracking == false),"`SafeUntrackedContext` requires an untracked policy!");
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>GenericTypeOfUntrackedDerivative&amp;</returns>
+		static inline GenericTypeOfUntrackedDerivative& repurpose()
+		{
+			return *(new GenericTypeOfUntrackedDerivative());
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="instancePointer"></param>
+		/// <returns>void</returns>
+		static inline void recycle(GenericTypeOfUntrackedDerivative* const instancePointer)
+		{
+			delete instancePointer;
+		};
+	};
+
+	/// <summary>
+	///		C++ class template: `SafeUntrackedContext`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfUntrackedDerivative"></typeparam>
+	/// <typeparam name="GenericPolicy"></typeparam>
+	template<typename GenericTypeOfUntrackedDerivative,typename GenericPolicy> class SafeUntrackedContext<GenericTypeOfUntrackedDerivative,GenericPolicy,true> : public SafeUntrackedAllocation<GenericTypeOfUntrackedDerivative,GenericPolicy::recycling>
+	{
+		static_assert((GenericPolicy::tracking == false),"`SafeUntrackedContext` requires an untracked policy!");
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeUntrackedContext`.
+		/// </summary>
+		inline SafeUntrackedContext() noexcept = default;
+
+		/// <summary>
+		///		Copy constructor of `SafeUntrackedContext`.
+		/// </summary>
+		inline SafeUntrackedContext(const SafeUntrackedContext&) noexcept = default;
+
+		/// <summary>
+		///		Move constructor of `SafeUntrackedContext`.
+		/// </summary>
+		inline SafeUntrackedContext(SafeUntrackedContext&&) noexcept = default;
+
+		/// <summary>
+		///		Destructor of `SafeUntrackedContext`.
+		/// </summary>
+		inline virtual ~SafeUntrackedContext() noexcept = default;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		///		operator=
+		/// </summary>
+		/// <returns>SafeUntrackedContext&amp;</returns>
+		inline SafeUntrackedContext& operator=(const SafeUntrackedContext&) noexcept = default;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		///		operator=
+		/// </summary>
+		/// <returns>SafeUntrackedContext&amp;</returns>
+		inline SafeUntrackedContext& operator=(SafeUntrackedContext&&) noexcept = default;
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>GenericTypeOfUntrackedDerivative&amp;</returns>
+		static inline GenericTypeOfUntrackedDerivative& repurpose()
+		{
+			return *(new GenericTypeOfUntrackedDerivative());
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="instancePointer"></param>
+		/// <returns>void</returns>
+		static inline void recycle(SafeUntrackedContext* const instancePointer)
+		{
+			delete instancePointer;
+		};
+	};
+
+	/// <summary>
+	///		C++ type name alias: `SafeContextBaseOf`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfDerivative"></typeparam>
+	/// <typeparam name="GenericPolicy"></typeparam>
+	template<typename GenericTypeOfDerivative,typename GenericPolicy> using SafeContextBaseOf = typename std::conditional<GenericPolicy::tracking,SafeContextBase,SafeUntrackedContext<GenericTypeOfDerivative,GenericPolicy>>::type;
+
+	/// <summary>
+	///		C++ structure template: `SafeTracked`.
+	/// </summary>
+	/// <typeparam name="GenericType"></typeparam>
+	template<typename GenericType> struct SafeTracked : std::is_base_of<SafeContextBase,GenericType>
+	{
+
+	};
+};
\ No newline at end of file
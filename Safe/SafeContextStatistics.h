@@ -0,0 +1,583 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <typeinfo>
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class: `SafeStripedCounter`.
+	/// </summary>
+	class SafeStripedCounter final
+	{
+	private:
+		static constexpr std::size_t stripeCount = 8;
+
+		/// <summary>
+		///		C++ structure: `SafeCounterStripe`.
+		/// </summary>
+		struct alignas(64) SafeCounterStripe
+		{
+			std::atomic<std::uint64_t> value;
+		};
+
+		SafeCounterStripe stripes[SafeStripedCounter::stripeCount];
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline std::size_t locateStripe() noexcept
+		{
+			static std::atomic<std::size_t> nextStripeIndex(0);
+			static thread_local std::size_t stripeIndex = (nextStripeIndex.fetch_add(1,std::memory_order_relaxed) % SafeStripedCounter::stripeCount);
+
+			return stripeIndex;
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeStripedCounter`.
+		/// </summary>
+		inline explicit SafeStripedCounter() noexcept : stripes()
+		{
+
+		};
+
+	private:
+		/// <summary>
+		///		Copy constructor of `SafeStripedCounter`.
+		/// </summary>
+		inline SafeStripedCounter(const SafeStripedCounter&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeStripedCounter`.
+		/// </summary>
+		inline SafeStripedCounter(SafeStripedCounter&&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeStripedCounter&amp;</returns>
+		inline SafeStripedCounter& operator=(const SafeStripedCounter&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeStripedCounter&amp;</returns>
+		inline SafeStripedCounter& operator=(SafeStripedCounter&&) = delete;
+
+	public:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		inline void increment() noexcept
+		{
+			((this->stripes)[SafeStripedCounter::locateStripe()].value).fetch_add(1,std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		inline std::uint64_t load() const noexcept
+		{
+			std::uint64_t value = 0;
+			std::size_t i = 0;
+
+			for (i = 0;i < SafeStripedCounter::stripeCount;i++)
+			{
+				value += ((this->stripes)[i].value).load(std::memory_order_relaxed);
+			}
+
+			return value;
+		};
+	};
+
+	/// <summary>
+	///		C++ enumeration: `SafePoolDecision`.
+	/// </summary>
+	enum class SafePoolDecision : int
+	{
+		Keep = 0,
+		Grow = 1,
+		Shrink = 2
+	};
+
+	/// <summary>
+	///		C++ class: `SafeTypeStatistics`.
+	/// </summary>
+	class SafeTypeStatistics final
+	{
+		friend class SafeContextStatistics;
+
+	private:
+		const std::type_info* typeInformationPointer;
+		std::size_t instanceSize;
+		SafeTypeStatistics* nextRecordPointer;
+		std::atomic<std::uint64_t> reservedCount;
+		std::atomic<std::uint64_t> warmUpNanoseconds;
+		SafeStripedCounter constructedCounter;
+		SafeStripedCounter destructedCounter;
+		std::atomic<std::uint64_t> composedChunkCount;
+		std::atomic<std::uint64_t> releasedChunkCount;
+		std::atomic<std::uint64_t> liveChunkSize;
+		SafeStripedCounter repurposeHitCounter;
+		SafeStripedCounter repurposeMissCounter;
+		std::atomic<std::uint64_t> lastMissNanoseconds;
+		std::atomic<std::uint64_t> missInterArrivalNanoseconds;
+		std::atomic<bool> missTiming;
+		std::atomic<int> poolDecision;
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeTypeStatistics`.
+		/// </summary>
+		/// <param name="typeInformation"></param>
+		/// <param name="instanceSize"></param>
+		inline explicit SafeTypeStatistics(const std::type_info& typeInformation,const std::size_t& instanceSize) noexcept : typeInformationPointer(std::addressof(typeInformation)),instanceSize(instanceSize),nextRecordPointer(nullptr),reservedCount(0),warmUpNanoseconds(0),constructedCounter(),destructedCounter(),composedChunkCount(0),releasedChunkCount(0),liveChunkSize(0),repurposeHitCounter(),repurposeMissCounter(),lastMissNanoseconds(0),missInterArrivalNanoseconds(0),missTiming(false),poolDecision(0)
+		{
+
+		};
+
+	private:
+		/// <summary>
+		///		Copy constructor of `SafeTypeStatistics`.
+		/// </summary>
+		inline SafeTypeStatistics(const SafeTypeStatistics&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeTypeStatistics`.
+		/// </summary>
+		inline SafeTypeStatistics(SafeTypeStatistics&&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeTypeStatistics&amp;</returns>
+		inline SafeTypeStatistics& operator=(const SafeTypeStatistics&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeTypeStatistics&amp;</returns>
+		inline SafeTypeStatistics& operator=(SafeTypeStatistics&&) = delete;
+
+	public:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="reservedCount"></param>
+		/// <param name="warmUpDuration"></param>
+		/// <returns>void</returns>
+		inline void recordWarmUp(const std::uint64_t& reservedCount,const std::chrono::nanoseconds& warmUpDuration) noexcept
+		{
+			(this->reservedCount).fetch_add(reservedCount,std::memory_order_relaxed);
+			(this->warmUpNanoseconds).fetch_add(static_cast<std::uint64_t>(warmUpDuration.count()),std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		inline void recordConstruction() noexcept
+		{
+			(this->constructedCounter).increment();
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		inline void recordDestruction() noexcept
+		{
+			(this->destructedCounter).increment();
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="chunkSize"></param>
+		/// <returns>void</returns>
+		inline void recordChunkComposition(const std::size_t& chunkSize) noexcept
+		{
+			(this->composedChunkCount).fetch_add(1,std::memory_order_relaxed);
+			(this->liveChunkSize).fetch_add(static_cast<std::uint64_t>(chunkSize),std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="chunkSize"></param>
+		/// <returns>void</returns>
+		inline void recordChunkRelease(const std::size_t& chunkSize) noexcept
+		{
+			(this->releasedChunkCount).fetch_add(1,std::memory_order_relaxed);
+			(this->liveChunkSize).fetch_sub(static_cast<std::uint64_t>(chunkSize),std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		inline void recordRepurposeHit() noexcept
+		{
+			(this->repurposeHitCounter).increment();
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		inline void recordRepurposeMiss() noexcept
+		{
+			(this->repurposeMissCounter).increment();
+
+			if ((this->missTiming).load(std::memory_order_relaxed) == false)
+			{
+				return;
+			}
+
+			std::uint64_t missNanoseconds = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+			std::uint64_t previousMissNanoseconds = (this->lastMissNanoseconds).exchange(missNanoseconds,std::memory_order_relaxed);
+
+			if ((previousMissNanoseconds != 0) && (missNanoseconds > previousMissNanoseconds))
+			{
+				std::uint64_t interArrivalNanoseconds = missNanoseconds - previousMissNanoseconds;
+				std::uint64_t averageNanoseconds = (this->missInterArrivalNanoseconds).load(std::memory_order_relaxed);
+
+				(this->missInterArrivalNanoseconds).store(((averageNanoseconds == 0) ? interArrivalNanoseconds : (averageNanoseconds - (averageNanoseconds / 8) + (interArrivalNanoseconds / 8))),std::memory_order_relaxed);
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="missTiming"></param>
+		/// <returns>void</returns>
+		inline void setMissTiming(const bool& missTiming) noexcept
+		{
+			(this->missTiming).store(missTiming,std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="poolDecision"></param>
+		/// <returns>void</returns>
+		inline void recordPoolDecision(const SafePoolDecision& poolDecision) noexcept
+		{
+			(this->poolDecision).store(static_cast<int>(poolDecision),std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>type_info&amp;</returns>
+		const std::type_info& getTypeInfo() const noexcept
+		{
+			return *(this->typeInformationPointer);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getInstanceSize() const noexcept
+		{
+			return this->instanceSize;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		std::uint64_t getReservedCount() const noexcept
+		{
+			return (this->reservedCount).load(std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>nanoseconds</returns>
+		std::chrono::nanoseconds getWarmUpDuration() const noexcept
+		{
+			return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>((this->warmUpNanoseconds).load(std::memory_order_relaxed)));
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		std::uint64_t getConstructedCount() const noexcept
+		{
+			return (this->constructedCounter).load();
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		std::uint64_t getLiveCount() const noexcept
+		{
+			std::uint64_t destructedCount = (this->destructedCounter).load();
+			std::uint64_t constructedCount = (this->constructedCounter).load();
+
+			return ((constructedCount > destructedCount) ? (constructedCount - destructedCount) : 0);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		std::uint64_t getLiveChunkCount() const noexcept
+		{
+			std::uint64_t releasedChunkCount = (this->releasedChunkCount).load(std::memory_order_relaxed);
+			std::uint64_t composedChunkCount = (this->composedChunkCount).load(std::memory_order_relaxed);
+
+			return ((composedChunkCount > releasedChunkCount) ? (composedChunkCount - releasedChunkCount) : 0);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		std::uint64_t getLiveChunkSize() const noexcept
+		{
+			return (this->liveChunkSize).load(std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		std::uint64_t getRepurposeHitCount() const noexcept
+		{
+			return (this->repurposeHitCounter).load();
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		std::uint64_t getRepurposeMissCount() const noexcept
+		{
+			return (this->repurposeMissCounter).load();
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>double</returns>
+		double getRepurposeHitRate() const noexcept
+		{
+			std::uint64_t hitCount = (this->repurposeHitCounter).load();
+			std::uint64_t missCount = (this->repurposeMissCounter).load();
+
+			return (((hitCount + missCount) == 0) ? 0.0 : (static_cast<double>(hitCount) / static_cast<double>(hitCount + missCount)));
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>nanoseconds</returns>
+		std::chrono::nanoseconds getMissInterArrival() const noexcept
+		{
+			return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>((this->missInterArrivalNanoseconds).load(std::memory_order_relaxed)));
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>SafePoolDecision</returns>
+		SafePoolDecision getPoolDecision() const noexcept
+		{
+			return static_cast<SafePoolDecision>((this->poolDecision).load(std::memory_order_relaxed));
+		};
+	};
+
+	/// <summary>
+	///		C++ class: `SafeContextStatistics`.
+	/// </summary>
+	class SafeContextStatistics final
+	{
+	private:
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>atomic&lt;SafeTypeStatistics*&gt;&amp;</returns>
+		static inline std::atomic<SafeTypeStatistics*>& referToHeadRecordPointer() noexcept
+		{
+			static std::atomic<SafeTypeStatistics*> headRecordPointer(nullptr);
+
+			return headRecordPointer;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>atomic&lt;uint64_t&gt;&amp;</returns>
+		static inline std::atomic<std::uint64_t>& referToLastWarmUpNanoseconds() noexcept
+		{
+			static std::atomic<std::uint64_t> lastWarmUpNanoseconds(0);
+
+			return lastWarmUpNanoseconds;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="recordReference"></param>
+		/// <returns>SafeTypeStatistics&amp;</returns>
+		static inline SafeTypeStatistics& enlistRecord(SafeTypeStatistics& recordReference) noexcept
+		{
+			std::atomic<SafeTypeStatistics*>& headRecordPointer = SafeContextStatistics::referToHeadRecordPointer();
+			SafeTypeStatistics* expectedRecordPointer = headRecordPointer.load(std::memory_order_relaxed);
+
+			do
+			{
+				recordReference.nextRecordPointer = expectedRecordPointer;
+			}
+			while (headRecordPointer.compare_exchange_weak(expectedRecordPointer,std::addressof(recordReference),std::memory_order_release,std::memory_order_relaxed) == false);
+
+			return recordReference;
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		/// <returns>SafeTypeStatistics&amp;</returns>
+		template<typename GenericTypeOfSafeContextDerivative> static inline SafeTypeStatistics& referToTypeStatistics()
+		{
+			static SafeTypeStatistics& enlistedRecord = SafeContextStatistics::enlistRecord(*(::new SafeTypeStatistics(typeid(GenericTypeOfSafeContextDerivative),sizeof(GenericTypeOfSafeContextDerivative))));
+
+			return enlistedRecord;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfFunction"></typeparam>
+		/// <param name="function"></param>
+		/// <returns>void</returns>
+		template<typename GenericTypeOfFunction> static inline void forEachTypeStatistics(GenericTypeOfFunction&& function)
+		{
+			const SafeTypeStatistics* recordPointer = SafeContextStatistics::referToHeadRecordPointer().load(std::memory_order_acquire);
+
+			while (recordPointer != nullptr)
+			{
+				function(*recordPointer);
+				recordPointer = recordPointer->nextRecordPointer;
+			}
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="warmUpDuration"></param>
+		/// <returns>void</returns>
+		static inline void recordLastWarmUp(const std::chrono::nanoseconds& warmUpDuration) noexcept
+		{
+			SafeContextStatistics::referToLastWarmUpNanoseconds().store(static_cast<std::uint64_t>(warmUpDuration.count()),std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>nanoseconds</returns>
+		static inline std::chrono::nanoseconds getLastWarmUpDuration() noexcept
+		{
+			return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(SafeContextStatistics::referToLastWarmUpNanoseconds().load(std::memory_order_relaxed)));
+		};
+	};
+};
\ No newline at end of file
@@ -0,0 +1,377 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextBase.h"
+#include "SafeContextException.h"
+#include "SafeTrace.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class: `EpochGuard`.
+	/// </summary>
+	class SafeContextBase::EpochGuard final
+	{
+	private:
+		/// <summary>
+		///		C++ structure: `SafeEpochRecord`.
+		/// </summary>
+		struct SafeEpochRecord
+		{
+			std::atomic<std::uint64_t> localEpoch;
+			std::atomic<bool> occupancy;
+			SafeEpochRecord* nextRecordPointer;
+			std::size_t nesting;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeRetiredInstance`.
+		/// </summary>
+		struct SafeRetiredInstance
+		{
+			SafeContextBase* instancePointer;
+			std::uint64_t retirementEpoch;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeEpochDomain`.
+		/// </summary>
+		struct SafeEpochDomain
+		{
+			std::atomic<std::uint64_t> globalEpoch;
+			std::atomic<SafeEpochRecord*> headRecordPointer;
+			std::mutex retirementMutex;
+			std::vector<SafeRetiredInstance> retiredInstances;
+			std::size_t reclamationCount;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeEpochRecordOwnership`.
+		/// </summary>
+		struct SafeEpochRecordOwnership
+		{
+			SafeEpochRecord* recordPointer;
+
+
+			/// <summary>
+			///		Destructor of `SafeEpochRecordOwnership`.
+			/// </summary>
+			inline ~SafeEpochRecordOwnership() noexcept
+			{
+				if (this->recordPointer != nullptr)
+				{
+					(this->recordPointer)->localEpoch.store(0,std::memory_order_release);
+					(this->recordPointer)->occupancy.store(false,std::memory_order_release);
+				}
+			};
+		};
+
+
+		static constexpr std::uint64_t activity = 1;
+		static constexpr std::size_t reclamationBatchCount = 64;
+
+		SafeEpochRecord* recordPointer;
+
+	public:
+		/// <summary>
+		///		Constructor of `EpochGuard`.
+		/// </summary>
+		inline explicit EpochGuard()
+		{
+			this->recordPointer = EpochGuard::referToThreadRecord();
+
+			if (((this->recordPointer)->nesting)++ == 0)
+			{
+				std::uint64_t observedEpoch = EpochGuard::referToDomain().globalEpoch.load(std::memory_order_relaxed);
+				(this->recordPointer)->localEpoch.store((observedEpoch << 1) | EpochGuard::activity,std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+			}
+		};
+
+	private:
+		/// <summary>
+		///		Copy constructor of `EpochGuard`.
+		/// </summary>
+		inline EpochGuard(const EpochGuard&) = delete;
+
+		/// <summary>
+		///		Move constructor of `EpochGuard`.
+		/// </summary>
+		inline EpochGuard(EpochGuard&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `EpochGuard`.
+		/// </summary>
+		inline ~EpochGuard() noexcept
+		{
+			if (--((this->recordPointer)->nesting) == 0)
+			{
+				(this->recordPointer)->localEpoch.store(0,std::memory_order_release);
+			}
+		};
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>EpochGuard&amp;</returns>
+		inline EpochGuard& operator=(const EpochGuard&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>EpochGuard&amp;</returns>
+		inline EpochGuard& operator=(EpochGuard&&) = delete;
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>SafeEpochDomain&amp;</returns>
+		static inline SafeEpochDomain& referToDomain()
+		{
+			static SafeEpochDomain domain{{0},{nullptr},{},{},EpochGuard::reclamationBatchCount};
+
+			return domain;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>SafeEpochRecord*</returns>
+		static inline SafeEpochRecord* referToThreadRecord()
+		{
+			thread_local SafeEpochRecordOwnership ownership{nullptr};
+
+			if (ownership.recordPointer == nullptr)
+			{
+				SafeEpochDomain& domain = EpochGuard::referToDomain();
+				SafeEpochRecord* recordPointer = domain.headRecordPointer.load(std::memory_order_acquire);
+
+				while (recordPointer != nullptr)
+				{
+					bool occupancy = false;
+
+					if ((recordPointer->occupancy.load(std::memory_order_relaxed) == false) && (recordPointer->occupancy.compare_exchange_strong(occupancy,true,std::memory_order_acq_rel) == true))
+					{
+						break;
+					}
+
+					recordPointer = recordPointer->nextRecordPointer;
+				}
+
+				if (recordPointer == nullptr)
+				{
+					recordPointer = ::new SafeEpochRecord();
+					recordPointer->localEpoch.store(0,std::memory_order_relaxed);
+					recordPointer->occupancy.store(true,std::memory_order_relaxed);
+					recordPointer->nesting = 0;
+					recordPointer->nextRecordPointer = domain.headRecordPointer.load(std::memory_order_relaxed);
+
+					while (domain.headRecordPointer.compare_exchange_weak(recordPointer->nextRecordPointer,recordPointer,std::memory_order_release,std::memory_order_relaxed) == false)
+					{
+
+					}
+				}
+
+				ownership.recordPointer = recordPointer;
+			}
+
+			return ownership.recordPointer;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>bool</returns>
+		static inline bool tryAdvance() noexcept
+		{
+			SafeEpochDomain& domain = EpochGuard::referToDomain();
+			std::uint64_t currentEpoch = domain.globalEpoch.load(std::memory_order_acquire);
+			const SafeEpochRecord* recordPointer = domain.headRecordPointer.load(std::memory_order_acquire);
+
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			while (recordPointer != nullptr)
+			{
+				std::uint64_t localEpoch = recordPointer->localEpoch.load(std::memory_order_acquire);
+
+				if (((localEpoch & EpochGuard::activity) != 0) && ((localEpoch >> 1) != currentEpoch))
+				{
+					return false;
+				}
+
+				recordPointer = recordPointer->nextRecordPointer;
+			}
+
+			return domain.globalEpoch.compare_exchange_strong(currentEpoch,currentEpoch + 1,std::memory_order_acq_rel);
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline std::size_t reclaim()
+		{
+			SafeEpochDomain& domain = EpochGuard::referToDomain();
+			std::vector<SafeContextBase*> reclaimedInstancePointers = std::vector<SafeContextBase*>();
+
+			if (EpochGuard::tryAdvance() == true)
+			{
+				EpochGuard::tryAdvance();
+			}
+
+			{
+				std::lock_guard<std::mutex> retirementLock(domain.retirementMutex);
+				std::uint64_t currentEpoch = domain.globalEpoch.load(std::memory_order_acquire);
+				std::size_t i = 0;
+				std::size_t j = 0;
+
+				for (i = 0;i < (domain.retiredInstances).size();i++)
+				{
+					if ((domain.retiredInstances)[i].retirementEpoch + 2 <= currentEpoch)
+					{
+						reclaimedInstancePointers.push_back((domain.retiredInstances)[i].instancePointer);
+					}
+					else
+					{
+						(domain.retiredInstances)[j++] = (domain.retiredInstances)[i];
+					}
+				}
+
+				(domain.retiredInstances).resize(j);
+				domain.reclamationCount = j + EpochGuard::reclamationBatchCount;
+			}
+
+			CPP_SAFE_TRACE(epoch_reclaim,reclaimedInstancePointers.size(),domain.globalEpoch.load(std::memory_order_relaxed));
+
+			for (SafeContextBase* const instancePointer : reclaimedInstancePointers)
+			{
+				SafeContextBase::recycle(instancePointer);
+			}
+
+			return reclaimedInstancePointers.size();
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="instancePointer"></param>
+		/// <returns>void</returns>
+		static inline void retire(SafeContextBase* const instancePointer)
+		{
+			if (instancePointer == nullptr)
+			{
+				throw SafeContextException("Argument `instancePointer` can't be `nullptr`!");
+			}
+
+			SafeEpochDomain& domain = EpochGuard::referToDomain();
+			bool reclamation = false;
+
+			{
+				std::lock_guard<std::mutex> retirementLock(domain.retirementMutex);
+				(domain.retiredInstances).push_back(SafeRetiredInstance{instancePointer,domain.globalEpoch.load(std::memory_order_acquire)});
+
+				if ((domain.retiredInstances).size() >= domain.reclamationCount)
+				{
+					domain.reclamationCount = std::numeric_limits<std::size_t>::max();
+					reclamation = true;
+				}
+			}
+
+			CPP_SAFE_TRACE(epoch_retire,reinterpret_cast<std::uintptr_t>(static_cast<const void*>(instancePointer)),0);
+
+			if (reclamation == true)
+			{
+				EpochGuard::reclaim();
+			}
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline std::size_t getPendingCount()
+		{
+			SafeEpochDomain& domain = EpochGuard::referToDomain();
+			std::lock_guard<std::mutex> retirementLock(domain.retirementMutex);
+
+			return (domain.retiredInstances).size();
+		};
+	};
+
+	/// <summary>
+	///		C++ type name alias: `SafeEpochGuard`.
+	/// </summary>
+	using SafeEpochGuard = SafeContextBase::EpochGuard;
+
+	/// <summary>
+	///		static
+	///		inline
+	/// </summary>
+	/// <param name="instanceReference"></param>
+	/// <returns>void</returns>
+	/// <exception cref="SafeContextException"/>
+	inline void recycleDeferred(SafeContextBase& instanceReference)
+	{
+		SafeContextBase::EpochGuard::retire(std::addressof(instanceReference));
+	};
+
+	/// <summary>
+	///		static
+	///		inline
+	/// </summary>
+	/// <param name="instancePointer"></param>
+	/// <returns>void</returns>
+	/// <exception cref="SafeContextException"/>
+	inline void recycleDeferred(SafeContextBase* const instancePointer)
+	{
+		SafeContextBase::EpochGuard::retire(instancePointer);
+	};
+};
\ No newline at end of file
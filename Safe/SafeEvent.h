@@ -25,6 +25,7 @@
 
 /** Inclusion(s) of project's C++ header file(s).**/
 #include "SafeContextBase.h"
+#include "SafeEventAwaiter.h"
 #include "SafeFunction.h"
 #include "SafeNamespace.h"
 #include "SafeTrade.h"
@@ -44,11 +45,15 @@ namespace Safe
 
 #endif
 
+	class SafeEventScheduler;
+
 	/// <summary>
 	///		C++ class: `SafeEvent`.
 	/// </summary>
 	class SafeEvent : public SafeContextBase
 	{
+		friend class SafeEventScheduler;
+
 	public:
 		typedef SafeFunction<void()> SafeEventOccurrence;
 
@@ -238,9 +243,9 @@ namespace Safe
 		///		Move constructor of `SafeEventHandler`.
 		/// </summary>
 		/// <param name="other"></param>
-		inline SafeEventHandler(SafeEventHandler<GenericTypeOfSafeEvent>&& other) noexcept(false) : SafeContextBase(static_cast<SafeContextBase&&>(other))
+		inline SafeEventHandler(SafeEventHandler<GenericTypeOfSafeEvent>&& other) noexcept(false) : SafeContextBase(static_cast<SafeContextBase&&>(other)),composedHandle(static_cast<SafeFunction<void(const GenericTypeOfSafeEvent&)>&&>(other.composedHandle))
 		{
-			this->composedHandle = static_cast<std::function<void(const GenericTypeOfSafeEvent&)>&&>(other.composedHandle);
+
 		};
 
 		/// <summary>
@@ -294,15 +299,15 @@ namespace Safe
 		/// <summary>
 		///		dynamic
 		///		inline
-		///		noexcept(false)
+		///		noexcept
 		///		operator=
 		/// </summary>
 		/// <param name="other"></param>
 		/// <returns>SafeEventHandler&lt;GenericTypeOfSafeEvent&gt;&amp;</returns>
-		inline SafeEventHandler<GenericTypeOfSafeEvent>& operator=(SafeEventHandler<GenericTypeOfSafeEvent>&& other) noexcept(false)
+		inline SafeEventHandler<GenericTypeOfSafeEvent>& operator=(SafeEventHandler<GenericTypeOfSafeEvent>&& other) noexcept
 		{
 			SafeContextBase::operator=(static_cast<SafeContextBase&&>(other));
-			this->composedHandle = static_cast<std::function<void(const GenericTypeOfSafeEvent&)>&&>(other.composedHandle);
+			this->composedHandle = static_cast<SafeFunction<void(const GenericTypeOfSafeEvent&)>&&>(other.composedHandle);
 
 			return *this;
 		};
@@ -316,6 +321,7 @@ namespace Safe
 		inline void handle(const GenericTypeOfSafeEvent& event)
 		{
 			(this->composedHandle)(event);
+			SafeEventWaitRegistry::notifyHandled(static_cast<const void*>(std::addressof(event)),static_cast<const void*>(std::addressof(*this)));
 		};
 
 		/// <summary>
@@ -326,7 +332,22 @@ namespace Safe
 		/// <returns>void</returns>
 		inline void handle(const GenericTypeOfSafeEvent* const eventPointer)
 		{
-			(this->composedHandle)(*eventPointer);
+			this->handle(*eventPointer);
 		};
 	};
+
+#if CPP_SAFE_INTERNAL_COROUTINE
+
+	/// <summary>
+	///		inline
+	///		operator co_await
+	/// </summary>
+	/// <param name="eventReference"></param>
+	/// <returns>SafeEventAwaiter&lt;bool&gt;</returns>
+	inline SafeEventAwaiter<bool> operator co_await(const SafeEvent& eventReference)
+	{
+		return SafeEventAwaiter<bool>(static_cast<const void*>(std::addressof(eventReference)),eventReference.getCancellation());
+	};
+
+#endif
 };
\ No newline at end of file
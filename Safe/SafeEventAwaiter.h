@@ -0,0 +1,445 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeNamespace.h"
+
+#if CPP_SAFE_INTERNAL_COROUTINE
+#include <coroutine>
+#endif
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	class SafeEvent;
+
+	template<typename GenericTypeOfSafeEvent> class SafeEventHandler;
+
+	/// <summary>
+	///		C++ class: `SafeEventWaitRegistry`.
+	/// </summary>
+	class SafeEventWaitRegistry final
+	{
+	public:
+		/// <summary>
+		///		C++ structure: `SafeEventWaiter`.
+		/// </summary>
+		struct SafeEventWaiter
+		{
+			const void* keyPointer = nullptr;
+			const void* payloadPointer = nullptr;
+			bool cancelled = false;
+			bool notified = false;
+			bool payloadBound = false;
+			void* resumeAddress = nullptr;
+			void (*resumeFunctionPointer)(void*) = nullptr;
+			SafeEventWaiter* nextWaiterPointer = nullptr;
+		};
+
+	private:
+		static constexpr std::size_t bucketCount = 64;
+
+		/// <summary>
+		///		C++ structure: `SafeWaiterBucket`.
+		/// </summary>
+		struct SafeWaiterBucket
+		{
+			std::mutex bucketMutex;
+			SafeEventWaiter* headWaiterPointer = nullptr;
+		};
+
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="keyPointer"></param>
+		/// <returns>SafeWaiterBucket&amp;</returns>
+		static inline SafeWaiterBucket& referToBucket(const void* const keyPointer) noexcept
+		{
+			static SafeWaiterBucket buckets[SafeEventWaitRegistry::bucketCount];
+
+			return buckets[(reinterpret_cast<std::uintptr_t>(keyPointer) >> 4) % SafeEventWaitRegistry::bucketCount];
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>atomic&lt;size_t&gt;&amp;</returns>
+		static inline std::atomic<std::size_t>& referToWaiterCount() noexcept
+		{
+			static std::atomic<std::size_t> waiterCount(0);
+
+			return waiterCount;
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="waiterReference"></param>
+		/// <returns>void</returns>
+		static inline void enlist(SafeEventWaiter& waiterReference)
+		{
+			SafeWaiterBucket& bucketReference = SafeEventWaitRegistry::referToBucket(waiterReference.keyPointer);
+			std::lock_guard<std::mutex> bucketLock(bucketReference.bucketMutex);
+
+			waiterReference.nextWaiterPointer = bucketReference.headWaiterPointer;
+			bucketReference.headWaiterPointer = std::addressof(waiterReference);
+			SafeEventWaitRegistry::referToWaiterCount().fetch_add(1,std::memory_order_release);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="waiterReference"></param>
+		/// <returns>bool</returns>
+		static inline bool delist(SafeEventWaiter& waiterReference)
+		{
+			SafeWaiterBucket& bucketReference = SafeEventWaitRegistry::referToBucket(waiterReference.keyPointer);
+			std::lock_guard<std::mutex> bucketLock(bucketReference.bucketMutex);
+			SafeEventWaiter** linkPointer = &(bucketReference.headWaiterPointer);
+
+			if (waiterReference.notified == true)
+			{
+				return false;
+			}
+
+			while (*linkPointer != nullptr)
+			{
+				if (*linkPointer == std::addressof(waiterReference))
+				{
+					*linkPointer = waiterReference.nextWaiterPointer;
+					waiterReference.nextWaiterPointer = nullptr;
+					SafeEventWaitRegistry::referToWaiterCount().fetch_sub(1,std::memory_order_relaxed);
+
+					return true;
+				}
+
+				linkPointer = &((*linkPointer)->nextWaiterPointer);
+			}
+
+			return false;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="waiterReference"></param>
+		/// <param name="resumeAddress"></param>
+		/// <param name="resumeFunctionPointer"></param>
+		/// <returns>bool</returns>
+		static inline bool suspend(SafeEventWaiter& waiterReference,void* const resumeAddress,void (*resumeFunctionPointer)(void*))
+		{
+			SafeWaiterBucket& bucketReference = SafeEventWaitRegistry::referToBucket(waiterReference.keyPointer);
+			std::lock_guard<std::mutex> bucketLock(bucketReference.bucketMutex);
+
+			if (waiterReference.notified == true)
+			{
+				return false;
+			}
+
+			waiterReference.resumeAddress = resumeAddress;
+			waiterReference.resumeFunctionPointer = resumeFunctionPointer;
+
+			return true;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="keyPointer"></param>
+		/// <param name="payloadPointer"></param>
+		/// <param name="cancelled"></param>
+		/// <returns>size_t</returns>
+		static inline std::size_t notify(const void* const keyPointer,const void* const payloadPointer,const bool& cancelled)
+		{
+			SafeEventWaiter* resumedWaiterPointer = nullptr;
+			std::size_t notifiedCount = 0;
+
+			if (SafeEventWaitRegistry::referToWaiterCount().load(std::memory_order_acquire) == 0)
+			{
+				return 0;
+			}
+
+			{
+				SafeWaiterBucket& bucketReference = SafeEventWaitRegistry::referToBucket(keyPointer);
+				std::lock_guard<std::mutex> bucketLock(bucketReference.bucketMutex);
+				SafeEventWaiter** linkPointer = &(bucketReference.headWaiterPointer);
+
+				while (*linkPointer != nullptr)
+				{
+					SafeEventWaiter* const waiterPointer = *linkPointer;
+
+					if ((waiterPointer->keyPointer == keyPointer) && ((waiterPointer->resumeFunctionPointer != nullptr) || (waiterPointer->payloadBound == false) || (cancelled == true)))
+					{
+						*linkPointer = waiterPointer->nextWaiterPointer;
+						waiterPointer->payloadPointer = payloadPointer;
+						waiterPointer->cancelled = cancelled;
+						waiterPointer->notified = true;
+						waiterPointer->nextWaiterPointer = nullptr;
+						notifiedCount++;
+
+						if (waiterPointer->resumeFunctionPointer != nullptr)
+						{
+							waiterPointer->nextWaiterPointer = resumedWaiterPointer;
+							resumedWaiterPointer = waiterPointer;
+						}
+					}
+					else
+					{
+						linkPointer = &(waiterPointer->nextWaiterPointer);
+					}
+				}
+
+				SafeEventWaitRegistry::referToWaiterCount().fetch_sub(notifiedCount,std::memory_order_relaxed);
+			}
+
+			while (resumedWaiterPointer != nullptr)
+			{
+				SafeEventWaiter* const nextWaiterPointer = resumedWaiterPointer->nextWaiterPointer;
+
+				resumedWaiterPointer->nextWaiterPointer = nullptr;
+				(resumedWaiterPointer->resumeFunctionPointer)(resumedWaiterPointer->resumeAddress);
+				resumedWaiterPointer = nextWaiterPointer;
+			}
+
+			return notifiedCount;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="eventReference"></param>
+		/// <returns>size_t</returns>
+		static inline std::size_t abandon(const SafeEvent& eventReference)
+		{
+			return SafeEventWaitRegistry::notify(static_cast<const void*>(std::addressof(eventReference)),nullptr,true);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeEvent"></typeparam>
+		/// <param name="eventHandlerReference"></param>
+		/// <returns>size_t</returns>
+		template<typename GenericTypeOfSafeEvent> static inline std::size_t abandon(const SafeEventHandler<GenericTypeOfSafeEvent>& eventHandlerReference)
+		{
+			return SafeEventWaitRegistry::notify(static_cast<const void*>(std::addressof(eventHandlerReference)),nullptr,true);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="eventPointer"></param>
+		/// <param name="eventHandlerPointer"></param>
+		/// <returns>size_t</returns>
+		static inline std::size_t notifyHandled(const void* const eventPointer,const void* const eventHandlerPointer)
+		{
+			if (SafeEventWaitRegistry::referToWaiterCount().load(std::memory_order_acquire) == 0)
+			{
+				return 0;
+			}
+
+			return SafeEventWaitRegistry::notify(eventPointer,eventPointer,false) + SafeEventWaitRegistry::notify(eventHandlerPointer,eventPointer,false);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline std::size_t getWaiterCount() noexcept
+		{
+			return SafeEventWaitRegistry::referToWaiterCount().load(std::memory_order_relaxed);
+		};
+	};
+
+#if CPP_SAFE_INTERNAL_COROUTINE
+
+	/// <summary>
+	///		C++ class template: `SafeEventAwaiter`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfResult"></typeparam>
+	template<typename GenericTypeOfResult> class SafeEventAwaiter final
+	{
+	private:
+		SafeEventWaitRegistry::SafeEventWaiter waiter;
+		bool abandoned;
+
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="resumeAddress"></param>
+		/// <returns>void</returns>
+		static inline void resumeCoroutine(void* resumeAddress)
+		{
+			std::coroutine_handle<>::from_address(resumeAddress).resume();
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeEventAwaiter`.
+		/// </summary>
+		/// <param name="keyPointer"></param>
+		/// <param name="cancelled"></param>
+		inline explicit SafeEventAwaiter(const void* const keyPointer,const bool& cancelled)
+		{
+			(this->waiter).keyPointer = keyPointer;
+			(this->waiter).cancelled = cancelled;
+			(this->waiter).payloadBound = (std::is_same<GenericTypeOfResult,bool>::value == false);
+			this->abandoned = cancelled;
+
+			if (this->abandoned == false)
+			{
+				SafeEventWaitRegistry::enlist(this->waiter);
+			}
+		};
+
+	private:
+		/// <summary>
+		///		Copy constructor of `SafeEventAwaiter`.
+		/// </summary>
+		inline SafeEventAwaiter(const SafeEventAwaiter&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeEventAwaiter`.
+		/// </summary>
+		inline SafeEventAwaiter(SafeEventAwaiter&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeEventAwaiter`.
+		/// </summary>
+		inline ~SafeEventAwaiter()
+		{
+			if (this->abandoned == false)
+			{
+				SafeEventWaitRegistry::delist(this->waiter);
+			}
+		};
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeEventAwaiter&amp;</returns>
+		inline SafeEventAwaiter& operator=(const SafeEventAwaiter&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeEventAwaiter&amp;</returns>
+		inline SafeEventAwaiter& operator=(SafeEventAwaiter&&) = delete;
+
+	public:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>bool</returns>
+		inline bool await_ready() const noexcept
+		{
+			return this->abandoned;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="coroutineHandle"></param>
+		/// <returns>bool</returns>
+		inline bool await_suspend(std::coroutine_handle<> coroutineHandle)
+		{
+			return SafeEventWaitRegistry::suspend(this->waiter,coroutineHandle.address(),&SafeEventAwaiter::resumeCoroutine);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>GenericTypeOfResult</returns>
+		inline GenericTypeOfResult await_resume() const noexcept
+		{
+			if constexpr (std::is_same<GenericTypeOfResult,bool>::value == true)
+			{
+				return ((this->waiter).cancelled == false);
+			}
+			else
+			{
+				return (((this->waiter).cancelled == true) ? nullptr : static_cast<GenericTypeOfResult>((this->waiter).payloadPointer));
+			}
+		};
+	};
+
+	/// <summary>
+	///		inline
+	///		operator co_await
+	/// </summary>
+	/// <param name="eventReference"></param>
+	/// <returns>SafeEventAwaiter&lt;bool&gt;</returns>
+	inline SafeEventAwaiter<bool> operator co_await(const SafeEvent& eventReference);
+
+	/// <summary>
+	///		inline
+	///		operator co_await
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeEvent"></typeparam>
+	/// <param name="eventHandlerReference"></param>
+	/// <returns>SafeEventAwaiter&lt;const GenericTypeOfSafeEvent*&gt;</returns>
+	template<typename GenericTypeOfSafeEvent> inline SafeEventAwaiter<const GenericTypeOfSafeEvent*> operator co_await(const SafeEventHandler<GenericTypeOfSafeEvent>& eventHandlerReference)
+	{
+		return SafeEventAwaiter<const GenericTypeOfSafeEvent*>(static_cast<const void*>(std::addressof(eventHandlerReference)),false);
+	};
+
+#endif
+};
\ No newline at end of file
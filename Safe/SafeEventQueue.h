@@ -0,0 +1,389 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeAlignment.h"
+#include "SafeContextBase.h"
+#include "SafeContextException.h"
+#include "SafeEvent.h"
+#include "SafeMemoryChunk.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class template: `SafeEventQueue`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeEvent"></typeparam>
+	template<typename GenericTypeOfSafeEvent> class SafeEventQueue final : public SafeContextBase
+	{
+		static_assert((std::is_base_of<SafeEvent,GenericTypeOfSafeEvent>::value == true),"`GenericTypeOfSafeEvent` must be a type that inherits from `SafeEvent`!");
+
+	private:
+		std::size_t capacity;
+		std::size_t positionMask;
+		std::unique_ptr<std::atomic<std::size_t>[]> sequences;
+		std::unique_ptr<bool[]> abandonments;
+		SafeContextBase::SafeMemoryChunk<GenericTypeOfSafeEvent> slotChunk;
+		alignas(SafeCacheLineAlignment::alignment) std::atomic<std::size_t> enqueuePosition;
+		alignas(SafeCacheLineAlignment::alignment) std::atomic<std::size_t> dequeuePosition;
+		alignas(SafeCacheLineAlignment::alignment) std::atomic<std::uint64_t> enqueuedCount;
+		std::atomic<std::uint64_t> rejectedCount;
+		alignas(SafeCacheLineAlignment::alignment) std::atomic<std::uint64_t> dequeuedCount;
+
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="capacity"></param>
+		/// <returns>size_t</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline std::size_t roundCapacity(const std::size_t& capacity)
+		{
+			std::size_t roundedCapacity = 1;
+
+			if (capacity == 0)
+			{
+				throw SafeContextException("Argument `capacity` must be positive!");
+			}
+
+			if (capacity > ((std::numeric_limits<std::size_t>::max() >> 1) + 1))
+			{
+				throw SafeContextException("Argument `capacity` is too large: `" + std::to_string(capacity) + "`!");
+			}
+
+			while (roundedCapacity < capacity)
+			{
+				roundedCapacity <<= 1;
+			}
+
+			return roundedCapacity;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="position"></param>
+		/// <returns>bool</returns>
+		inline bool claimPosition(std::size_t& position) noexcept
+		{
+			position = (this->enqueuePosition).load(std::memory_order_relaxed);
+
+			while (true)
+			{
+				std::size_t sequence = ((this->sequences)[position & this->positionMask]).load(std::memory_order_acquire);
+				std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+				if (difference == 0)
+				{
+					if ((this->enqueuePosition).compare_exchange_weak(position,position + 1,std::memory_order_relaxed) == true)
+					{
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					(this->rejectedCount).fetch_add(1,std::memory_order_relaxed);
+
+					return false;
+				}
+				else
+				{
+					position = (this->enqueuePosition).load(std::memory_order_relaxed);
+				}
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="position"></param>
+		/// <returns>void</returns>
+		inline void publishPosition(const std::size_t& position) noexcept
+		{
+			((this->sequences)[position & this->positionMask]).store(position + 1,std::memory_order_release);
+			(this->enqueuedCount).fetch_add(1,std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="position"></param>
+		/// <returns>void</returns>
+		inline void abandonPosition(const std::size_t& position) noexcept
+		{
+			(this->abandonments)[position & this->positionMask] = true;
+			((this->sequences)[position & this->positionMask]).store(position + 1,std::memory_order_release);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="position"></param>
+		/// <returns>void</returns>
+		inline void releasePosition(const std::size_t& position) noexcept
+		{
+			(this->abandonments)[position & this->positionMask] = false;
+			((this->sequences)[position & this->positionMask]).store(position + this->capacity,std::memory_order_release);
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeEventQueue`.
+		/// </summary>
+		/// <param name="capacity"></param>
+		inline explicit SafeEventQueue(const std::size_t& capacity = 1024) : SafeContextBase(),capacity(SafeEventQueue::roundCapacity(capacity)),positionMask(SafeEventQueue::roundCapacity(capacity) - 1),sequences(::new std::atomic<std::size_t>[SafeEventQueue::roundCapacity(capacity)]),abandonments(::new bool[SafeEventQueue::roundCapacity(capacity)]()),slotChunk(SafeEventQueue::roundCapacity(capacity)),enqueuePosition(0),dequeuePosition(0),enqueuedCount(0),rejectedCount(0),dequeuedCount(0)
+		{
+			std::size_t i = 0;
+
+			for (i = 0;i < this->capacity;i++)
+			{
+				((this->sequences)[i]).store(i,std::memory_order_relaxed);
+			}
+		};
+
+	private:
+		/// <summary>
+		///		Copy constructor of `SafeEventQueue`.
+		/// </summary>
+		inline SafeEventQueue(const SafeEventQueue&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeEventQueue`.
+		/// </summary>
+		inline SafeEventQueue(SafeEventQueue&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeEventQueue`.
+		/// </summary>
+		inline virtual ~SafeEventQueue() noexcept(false) override = default;
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeEventQueue&amp;</returns>
+		inline SafeEventQueue& operator=(const SafeEventQueue&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeEventQueue&amp;</returns>
+		inline SafeEventQueue& operator=(SafeEventQueue&&) = delete;
+
+	public:
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="event"></param>
+		/// <returns>bool</returns>
+		inline bool enqueue(const GenericTypeOfSafeEvent& event)
+		{
+			std::size_t position = 0;
+
+			if (this->claimPosition(position) == false)
+			{
+				return false;
+			}
+
+			try
+			{
+				(this->slotChunk)[position & this->positionMask] = event;
+			}
+			catch (...)
+			{
+				this->abandonPosition(position);
+
+				throw;
+			}
+
+			this->publishPosition(position);
+
+			return true;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="event"></param>
+		/// <returns>bool</returns>
+		inline bool enqueue(GenericTypeOfSafeEvent&& event)
+		{
+			std::size_t position = 0;
+
+			if (this->claimPosition(position) == false)
+			{
+				return false;
+			}
+
+			try
+			{
+				(this->slotChunk)[position & this->positionMask] = static_cast<GenericTypeOfSafeEvent&&>(event);
+			}
+			catch (...)
+			{
+				this->abandonPosition(position);
+
+				throw;
+			}
+
+			this->publishPosition(position);
+
+			return true;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="eventHandler"></param>
+		/// <param name="batchCardinality"></param>
+		/// <returns>size_t</returns>
+		inline std::size_t drain(SafeEventHandler<GenericTypeOfSafeEvent>& eventHandler,const std::size_t& batchCardinality = std::numeric_limits<std::size_t>::max())
+		{
+			std::size_t position = (this->dequeuePosition).load(std::memory_order_relaxed);
+			std::size_t drainedCount = 0;
+
+			while (drainedCount < batchCardinality)
+			{
+				if (((this->sequences)[position & this->positionMask]).load(std::memory_order_acquire) != (position + 1))
+				{
+					break;
+				}
+
+				GenericTypeOfSafeEvent& slotReference = (this->slotChunk)[position & this->positionMask];
+				bool abandonment = (this->abandonments)[position & this->positionMask];
+
+				try
+				{
+					if (abandonment == false)
+					{
+						eventHandler.handle(slotReference);
+					}
+				}
+				catch (...)
+				{
+					this->releasePosition(position);
+					(this->dequeuePosition).store(position + 1,std::memory_order_relaxed);
+					(this->dequeuedCount).fetch_add(drainedCount + ((abandonment == false) ? 1 : 0),std::memory_order_relaxed);
+
+					throw;
+				}
+
+				this->releasePosition(position);
+				position++;
+
+				if (abandonment == true)
+				{
+					continue;
+				}
+
+				drainedCount++;
+			}
+
+			(this->dequeuePosition).store(position,std::memory_order_relaxed);
+			(this->dequeuedCount).fetch_add(drainedCount,std::memory_order_relaxed);
+
+			return drainedCount;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getCapacity() const noexcept
+		{
+			return this->capacity;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getSize() const noexcept
+		{
+			std::size_t dequeuePosition = (this->dequeuePosition).load(std::memory_order_relaxed);
+			std::size_t enqueuePosition = (this->enqueuePosition).load(std::memory_order_relaxed);
+
+			return ((enqueuePosition > dequeuePosition) ? (enqueuePosition - dequeuePosition) : 0);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		std::uint64_t getEnqueuedCount() const noexcept
+		{
+			return (this->enqueuedCount).load(std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		std::uint64_t getDequeuedCount() const noexcept
+		{
+			return (this->dequeuedCount).load(std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		std::uint64_t getRejectedCount() const noexcept
+		{
+			return (this->rejectedCount).load(std::memory_order_relaxed);
+		};
+	};
+};
\ No newline at end of file
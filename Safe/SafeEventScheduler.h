@@ -0,0 +1,701 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextException.h"
+#include "SafeEvent.h"
+#include "SafeTrace.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class: `SafeEventScheduler`.
+	/// </summary>
+	class SafeEventScheduler final
+	{
+	private:
+		static constexpr std::size_t levelCount = 4;
+		static constexpr std::size_t slotBitCount = 6;
+		static constexpr std::size_t slotCount = static_cast<std::size_t>(1) << SafeEventScheduler::slotBitCount;
+		static constexpr std::uint64_t slotMask = SafeEventScheduler::slotCount - 1;
+		static constexpr std::uint64_t tickRange = static_cast<std::uint64_t>(1) << (SafeEventScheduler::slotBitCount * SafeEventScheduler::levelCount);
+
+		/// <summary>
+		///		C++ structure: `SafeTimerNode`.
+		/// </summary>
+		struct SafeTimerNode
+		{
+			SafeEvent* eventPointer = nullptr;
+			std::uint64_t period = 0;
+			std::uint64_t expiry = 0;
+			SafeTimerNode* previousNodePointer = nullptr;
+			SafeTimerNode* nextNodePointer = nullptr;
+			SafeTimerNode** slotPointer = nullptr;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeTimerWheel`.
+		/// </summary>
+		struct SafeTimerWheel
+		{
+			std::mutex wheelMutex;
+			std::condition_variable wheelCondition;
+			std::unordered_map<const SafeEvent*,SafeTimerNode> timerNodes;
+			SafeTimerNode* slots[SafeEventScheduler::levelCount][SafeEventScheduler::slotCount] = {};
+			std::uint64_t currentTick = 0;
+			std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			const SafeEvent* firingEventPointer = nullptr;
+			std::size_t failureCount = 0;
+			std::thread::id timerThreadIdentifier;
+			bool stopping = false;
+			std::thread timerThread;
+		};
+
+		std::vector<std::unique_ptr<SafeTimerWheel>> wheels;
+
+
+		/// <summary>
+		///		Constructor of `SafeEventScheduler`.
+		/// </summary>
+		inline explicit SafeEventScheduler()
+		{
+			std::size_t threadCount = std::thread::hardware_concurrency() / 4;
+			std::size_t i = 0;
+
+			if (threadCount == 0)
+			{
+				threadCount = 1;
+			}
+			else if (threadCount > 4)
+			{
+				threadCount = 4;
+			}
+
+			for (i = 0;i < threadCount;i++)
+			{
+				(this->wheels).push_back(std::unique_ptr<SafeTimerWheel>(::new SafeTimerWheel()));
+			}
+
+			try
+			{
+				for (i = 0;i < threadCount;i++)
+				{
+					SafeTimerWheel* const wheelPointer = (this->wheels)[i].get();
+
+					wheelPointer->timerThread = std::thread([wheelPointer]() -> void
+					{
+						SafeEventScheduler::runWheel(*wheelPointer);
+					});
+				}
+			}
+			catch (...)
+			{
+				this->stop();
+
+				throw;
+			}
+		};
+
+		/// <summary>
+		///		Copy constructor of `SafeEventScheduler`.
+		/// </summary>
+		inline SafeEventScheduler(const SafeEventScheduler&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeEventScheduler`.
+		/// </summary>
+		inline SafeEventScheduler(SafeEventScheduler&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeEventScheduler`.
+		/// </summary>
+		inline ~SafeEventScheduler()
+		{
+			this->stop();
+		};
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>void</returns>
+		inline void stop()
+		{
+			std::size_t i = 0;
+
+			for (i = 0;i < (this->wheels).size();i++)
+			{
+				{
+					std::lock_guard<std::mutex> wheelLock(((this->wheels)[i])->wheelMutex);
+
+					((this->wheels)[i])->stopping = true;
+				}
+
+				(((this->wheels)[i])->wheelCondition).notify_all();
+			}
+
+			for (i = 0;i < (this->wheels).size();i++)
+			{
+				if ((((this->wheels)[i])->timerThread).joinable() == true)
+				{
+					(((this->wheels)[i])->timerThread).join();
+				}
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeEventScheduler&amp;</returns>
+		inline SafeEventScheduler& operator=(const SafeEventScheduler&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeEventScheduler&amp;</returns>
+		inline SafeEventScheduler& operator=(SafeEventScheduler&&) = delete;
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>SafeEventScheduler&amp;</returns>
+		static inline SafeEventScheduler& referToScheduler()
+		{
+			static SafeEventScheduler scheduler;
+
+			return scheduler;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="eventPointer"></param>
+		/// <returns>SafeTimerWheel&amp;</returns>
+		static inline SafeTimerWheel& referToWheel(const SafeEvent* const eventPointer)
+		{
+			SafeEventScheduler& scheduler = SafeEventScheduler::referToScheduler();
+			std::size_t wheelIndex = (reinterpret_cast<std::uintptr_t>(eventPointer) >> 4) % (scheduler.wheels).size();
+
+			return *((scheduler.wheels)[wheelIndex]);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="wheelReference"></param>
+		/// <returns>uint64_t</returns>
+		static inline std::uint64_t referToElapsedTick(const SafeTimerWheel& wheelReference) noexcept
+		{
+			return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - wheelReference.startTime).count());
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="wheelReference"></param>
+		/// <param name="nodeReference"></param>
+		/// <returns>void</returns>
+		static inline void insertNode(SafeTimerWheel& wheelReference,SafeTimerNode& nodeReference) noexcept
+		{
+			std::uint64_t placement = nodeReference.expiry;
+			std::size_t level = 0;
+
+			if (placement <= wheelReference.currentTick)
+			{
+				placement = wheelReference.currentTick + 1;
+			}
+
+			if ((placement - wheelReference.currentTick) >= SafeEventScheduler::tickRange)
+			{
+				placement = wheelReference.currentTick + SafeEventScheduler::tickRange - 1;
+			}
+
+			while ((level + 1 < SafeEventScheduler::levelCount) && ((placement - wheelReference.currentTick) >= (static_cast<std::uint64_t>(1) << (SafeEventScheduler::slotBitCount * (level + 1)))))
+			{
+				level++;
+			}
+
+			SafeTimerNode** const slotPointer = &(wheelReference.slots[level][(placement >> (SafeEventScheduler::slotBitCount * level)) & SafeEventScheduler::slotMask]);
+
+			nodeReference.slotPointer = slotPointer;
+			nodeReference.previousNodePointer = nullptr;
+			nodeReference.nextNodePointer = *slotPointer;
+
+			if (*slotPointer != nullptr)
+			{
+				(*slotPointer)->previousNodePointer = std::addressof(nodeReference);
+			}
+
+			*slotPointer = std::addressof(nodeReference);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="nodeReference"></param>
+		/// <returns>void</returns>
+		static inline void removeNode(SafeTimerNode& nodeReference) noexcept
+		{
+			if (nodeReference.slotPointer == nullptr)
+			{
+				return;
+			}
+
+			if (nodeReference.previousNodePointer != nullptr)
+			{
+				(nodeReference.previousNodePointer)->nextNodePointer = nodeReference.nextNodePointer;
+			}
+			else
+			{
+				*(nodeReference.slotPointer) = nodeReference.nextNodePointer;
+			}
+
+			if (nodeReference.nextNodePointer != nullptr)
+			{
+				(nodeReference.nextNodePointer)->previousNodePointer = nodeReference.previousNodePointer;
+			}
+
+			nodeReference.previousNodePointer = nullptr;
+			nodeReference.nextNodePointer = nullptr;
+			nodeReference.slotPointer = nullptr;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="wheelReference"></param>
+		/// <param name="level"></param>
+		/// <param name="slotIndex"></param>
+		/// <returns>SafeTimerNode*</returns>
+		static inline SafeTimerNode* detachSlot(SafeTimerWheel& wheelReference,const std::size_t& level,const std::size_t& slotIndex) noexcept
+		{
+			SafeTimerNode* nodePointer = wheelReference.slots[level][slotIndex];
+
+			wheelReference.slots[level][slotIndex] = nullptr;
+
+			return nodePointer;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="wheelReference"></param>
+		/// <returns>uint64_t</returns>
+		static inline std::uint64_t referToNextTick(const SafeTimerWheel& wheelReference) noexcept
+		{
+			std::uint64_t nextTick = wheelReference.currentTick + SafeEventScheduler::tickRange;
+			std::size_t level = 0;
+			std::size_t i = 0;
+
+			for (i = 1;i < SafeEventScheduler::slotCount;i++)
+			{
+				if (wheelReference.slots[0][(wheelReference.currentTick + i) & SafeEventScheduler::slotMask] != nullptr)
+				{
+					nextTick = wheelReference.currentTick + i;
+
+					break;
+				}
+			}
+
+			for (level = 1;level < SafeEventScheduler::levelCount;level++)
+			{
+				const std::uint64_t cascadeTick = ((wheelReference.currentTick >> (SafeEventScheduler::slotBitCount * level)) + 1) << (SafeEventScheduler::slotBitCount * level);
+
+				if (cascadeTick >= nextTick)
+				{
+					break;
+				}
+
+				for (i = 0;i < SafeEventScheduler::slotCount;i++)
+				{
+					if (wheelReference.slots[level][i] != nullptr)
+					{
+						nextTick = cascadeTick;
+
+						break;
+					}
+				}
+			}
+
+			return nextTick;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="wheelReference"></param>
+		/// <param name="targetTick"></param>
+		/// <param name="expiredEventPointers"></param>
+		/// <returns>void</returns>
+		static inline void advanceTick(SafeTimerWheel& wheelReference,const std::uint64_t& targetTick,std::vector<SafeEvent*>& expiredEventPointers)
+		{
+			SafeTimerNode* nodePointer = nullptr;
+			std::size_t level = 0;
+
+			wheelReference.currentTick++;
+
+			for (level = 1;level < SafeEventScheduler::levelCount;level++)
+			{
+				if ((wheelReference.currentTick & ((static_cast<std::uint64_t>(1) << (SafeEventScheduler::slotBitCount * level)) - 1)) != 0)
+				{
+					break;
+				}
+
+				nodePointer = SafeEventScheduler::detachSlot(wheelReference,level,(wheelReference.currentTick >> (SafeEventScheduler::slotBitCount * level)) & SafeEventScheduler::slotMask);
+
+				while (nodePointer != nullptr)
+				{
+					SafeTimerNode* const nextNodePointer = nodePointer->nextNodePointer;
+
+					SafeEventScheduler::insertNode(wheelReference,*nodePointer);
+					nodePointer = nextNodePointer;
+				}
+			}
+
+			nodePointer = SafeEventScheduler::detachSlot(wheelReference,0,wheelReference.currentTick & SafeEventScheduler::slotMask);
+
+			while (nodePointer != nullptr)
+			{
+				SafeTimerNode* const nextNodePointer = nodePointer->nextNodePointer;
+
+				if (nodePointer->expiry <= wheelReference.currentTick)
+				{
+					expiredEventPointers.push_back(nodePointer->eventPointer);
+					nodePointer->expiry += nodePointer->period;
+
+					if (nodePointer->expiry <= targetTick)
+					{
+						nodePointer->expiry += (((targetTick - nodePointer->expiry) / nodePointer->period) + 1) * nodePointer->period;
+					}
+				}
+
+				SafeEventScheduler::insertNode(wheelReference,*nodePointer);
+				nodePointer = nextNodePointer;
+			}
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="wheelReference"></param>
+		/// <returns>void</returns>
+		static inline void runWheel(SafeTimerWheel& wheelReference)
+		{
+			std::vector<SafeEvent*> expiredEventPointers;
+			std::unique_lock<std::mutex> wheelLock(wheelReference.wheelMutex);
+			std::size_t i = 0;
+
+			wheelReference.timerThreadIdentifier = std::this_thread::get_id();
+
+			while (wheelReference.stopping == false)
+			{
+				std::uint64_t targetTick = SafeEventScheduler::referToElapsedTick(wheelReference);
+
+				while (wheelReference.currentTick < targetTick)
+				{
+					SafeEventScheduler::advanceTick(wheelReference,targetTick,expiredEventPointers);
+				}
+
+				for (i = 0;i < expiredEventPointers.size();i++)
+				{
+					SafeEvent* const eventPointer = expiredEventPointers[i];
+
+					bool cancelled = false;
+
+					if ((wheelReference.timerNodes).find(eventPointer) == (wheelReference.timerNodes).end())
+					{
+						continue;
+					}
+
+					cancelled = eventPointer->getCancellation();
+
+					if ((cancelled == true) && (SafeEventWaitRegistry::getWaiterCount() == 0))
+					{
+						continue;
+					}
+
+					wheelReference.firingEventPointer = eventPointer;
+					wheelLock.unlock();
+					CPP_SAFE_TRACE(scheduler_fire,reinterpret_cast<std::uintptr_t>(static_cast<void*>(eventPointer)),cancelled);
+
+					try
+					{
+						if (cancelled == false)
+						{
+							(eventPointer->occurrence)();
+						}
+
+						SafeEventWaitRegistry::notify(static_cast<const void*>(eventPointer),static_cast<const void*>(eventPointer),cancelled);
+					}
+					catch (...)
+					{
+						wheelLock.lock();
+						wheelReference.firingEventPointer = nullptr;
+						wheelReference.failureCount++;
+						(wheelReference.wheelCondition).notify_all();
+
+						continue;
+					}
+
+					wheelLock.lock();
+					wheelReference.firingEventPointer = nullptr;
+					(wheelReference.wheelCondition).notify_all();
+				}
+
+				expiredEventPointers.clear();
+
+				if ((wheelReference.timerNodes).empty() == true)
+				{
+					(wheelReference.wheelCondition).wait(wheelLock);
+				}
+				else
+				{
+					(wheelReference.wheelCondition).wait_until(wheelLock,wheelReference.startTime + std::chrono::milliseconds(SafeEventScheduler::referToNextTick(wheelReference)));
+				}
+			}
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="wheelReference"></param>
+		/// <param name="eventPointer"></param>
+		/// <returns>bool</returns>
+		static inline bool disarm(SafeTimerWheel& wheelReference,const SafeEvent* const eventPointer) noexcept
+		{
+			auto nodeIterator = (wheelReference.timerNodes).find(eventPointer);
+
+			if (nodeIterator == (wheelReference.timerNodes).end())
+			{
+				return false;
+			}
+
+			SafeEventScheduler::removeNode(nodeIterator->second);
+			(wheelReference.timerNodes).erase(nodeIterator);
+
+			return true;
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="eventReference"></param>
+		/// <param name="period"></param>
+		/// <param name="delay"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline void schedule(SafeEvent& eventReference,const std::chrono::milliseconds& period,const std::chrono::milliseconds& delay)
+		{
+			if (period.count() <= 0)
+			{
+				throw SafeContextException("Argument `period` must be positive!");
+			}
+
+			if (delay.count() < 0)
+			{
+				throw SafeContextException("Argument `delay` must not be negative!");
+			}
+
+			SafeTimerWheel& wheelReference = SafeEventScheduler::referToWheel(std::addressof(eventReference));
+
+			{
+				std::lock_guard<std::mutex> wheelLock(wheelReference.wheelMutex);
+				std::uint64_t elapsedTick = SafeEventScheduler::referToElapsedTick(wheelReference);
+
+				if ((wheelReference.timerNodes).empty() == true)
+				{
+					wheelReference.currentTick = elapsedTick;
+				}
+
+				SafeTimerNode& nodeReference = (wheelReference.timerNodes)[std::addressof(eventReference)];
+
+				SafeEventScheduler::removeNode(nodeReference);
+				nodeReference.eventPointer = std::addressof(eventReference);
+				nodeReference.period = static_cast<std::uint64_t>(period.count());
+				nodeReference.expiry = elapsedTick + static_cast<std::uint64_t>(delay.count());
+				SafeEventScheduler::insertNode(wheelReference,nodeReference);
+			}
+
+			(wheelReference.wheelCondition).notify_all();
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="eventReference"></param>
+		/// <param name="period"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline void schedule(SafeEvent& eventReference,const std::chrono::milliseconds& period)
+		{
+			SafeEventScheduler::schedule(eventReference,period,period);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="eventReference"></param>
+		/// <param name="period"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline void broadcastEvery(SafeEvent& eventReference,const std::chrono::milliseconds& period)
+		{
+			SafeEventScheduler::schedule(eventReference,period,std::chrono::milliseconds(0));
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="eventReference"></param>
+		/// <returns>bool</returns>
+		static inline bool unschedule(const SafeEvent& eventReference)
+		{
+			SafeTimerWheel& wheelReference = SafeEventScheduler::referToWheel(std::addressof(eventReference));
+			std::unique_lock<std::mutex> wheelLock(wheelReference.wheelMutex);
+			bool disarmed = SafeEventScheduler::disarm(wheelReference,std::addressof(eventReference));
+
+			if (std::this_thread::get_id() != wheelReference.timerThreadIdentifier)
+			{
+				(wheelReference.wheelCondition).wait(wheelLock,[&wheelReference,&eventReference]() -> bool
+				{
+					return (wheelReference.firingEventPointer != std::addressof(eventReference));
+				});
+			}
+
+			if (disarmed == true)
+			{
+				wheelLock.unlock();
+				SafeEventWaitRegistry::abandon(eventReference);
+			}
+
+			return disarmed;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="eventReference"></param>
+		/// <returns>bool</returns>
+		static inline bool isScheduled(const SafeEvent& eventReference)
+		{
+			SafeTimerWheel& wheelReference = SafeEventScheduler::referToWheel(std::addressof(eventReference));
+			std::lock_guard<std::mutex> wheelLock(wheelReference.wheelMutex);
+
+			return ((wheelReference.timerNodes).find(std::addressof(eventReference)) != (wheelReference.timerNodes).end());
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline std::size_t getScheduledCount()
+		{
+			SafeEventScheduler& scheduler = SafeEventScheduler::referToScheduler();
+			std::size_t scheduledCount = 0;
+			std::size_t i = 0;
+
+			for (i = 0;i < (scheduler.wheels).size();i++)
+			{
+				std::lock_guard<std::mutex> wheelLock(((scheduler.wheels)[i])->wheelMutex);
+
+				scheduledCount += (((scheduler.wheels)[i])->timerNodes).size();
+			}
+
+			return scheduledCount;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline std::size_t getFailureCount()
+		{
+			SafeEventScheduler& scheduler = SafeEventScheduler::referToScheduler();
+			std::size_t failureCount = 0;
+			std::size_t i = 0;
+
+			for (i = 0;i < (scheduler.wheels).size();i++)
+			{
+				std::lock_guard<std::mutex> wheelLock(((scheduler.wheels)[i])->wheelMutex);
+
+				failureCount += ((scheduler.wheels)[i])->failureCount;
+			}
+
+			return failureCount;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline std::size_t getThreadCount()
+		{
+			return (SafeEventScheduler::referToScheduler().wheels).size();
+		};
+	};
+};
\ No newline at end of file
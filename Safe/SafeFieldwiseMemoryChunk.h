@@ -0,0 +1,518 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <memory>
+#include <new>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeAlignment.h"
+#include "SafeContextBase.h"
+#include "SafeContextException.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ structure template: `SafeFieldTraits`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfFieldPointer"></typeparam>
+	template<typename GenericTypeOfFieldPointer> struct SafeFieldTraits;
+
+	/// <summary>
+	///		C++ structure template: `SafeFieldTraits`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfField"></typeparam>
+	/// <typeparam name="GenericTypeOfOwner"></typeparam>
+	template<typename GenericTypeOfField,typename GenericTypeOfOwner> struct SafeFieldTraits<GenericTypeOfField GenericTypeOfOwner::*>
+	{
+		typedef GenericTypeOfField SafeFieldType;
+		typedef GenericTypeOfOwner SafeOwnerType;
+	};
+
+	/// <summary>
+	///		C++ class template: `SafeFieldwiseMemoryChunk`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	/// <typeparam name="...GenericFieldPointers"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative,auto ...GenericFieldPointers> class SafeFieldwiseMemoryChunk final : public SafeContextBase
+	{
+		static_assert((sizeof...(GenericFieldPointers) > 0),"`GenericFieldPointers` must name at least one field!");
+		static_assert(((std::is_member_object_pointer<decltype(GenericFieldPointers)>::value == true) && ...),"`GenericFieldPointers` must be pointers to data members!");
+		static_assert(((std::is_base_of<typename SafeFieldTraits<decltype(GenericFieldPointers)>::SafeOwnerType,GenericTypeOfSafeContextDerivative>::value == true) && ...),"`GenericFieldPointers` must be data members of `GenericTypeOfSafeContextDerivative`!");
+		static_assert(((std::is_copy_constructible<typename SafeFieldTraits<decltype(GenericFieldPointers)>::SafeFieldType>::value == true) && ...),"Every field named by `GenericFieldPointers` must be copy constructible!");
+		static_assert((std::is_default_constructible<GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type having a default constructor!");
+		static_assert((std::is_pointer<GenericTypeOfSafeContextDerivative>::value == false),"`GenericTypeOfSafeContextDerivative` can't be a pointer type!");
+
+	public:
+		/// <summary>
+		///		C++ class: `SafeFieldwiseView`.
+		/// </summary>
+		class SafeFieldwiseView;
+
+		/// <summary>
+		///		C++ class: `SafeConstantFieldwiseView`.
+		/// </summary>
+		class SafeConstantFieldwiseView;
+
+
+		static constexpr std::size_t fieldAlignment = SafeCacheLineAlignment::alignment;
+
+	private:
+		std::tuple<typename SafeFieldTraits<decltype(GenericFieldPointers)>::SafeFieldType*...> fieldBufferPointers;
+		std::size_t cardinality;
+
+
+		/// <summary>
+		///		static
+		///		inline
+		///		constexpr
+		///		noexcept
+		/// </summary>
+		/// <typeparam name="GenericFieldPointer"></typeparam>
+		/// <typeparam name="GenericCandidateFieldPointer"></typeparam>
+		/// <returns>bool</returns>
+		template<auto GenericFieldPointer,auto GenericCandidateFieldPointer> static inline constexpr bool matchField() noexcept
+		{
+			if constexpr (std::is_same<decltype(GenericFieldPointer),decltype(GenericCandidateFieldPointer)>::value == true)
+			{
+				return (GenericFieldPointer == GenericCandidateFieldPointer);
+			}
+			else
+			{
+				return false;
+			}
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		constexpr
+		///		noexcept
+		/// </summary>
+		/// <typeparam name="GenericFieldPointer"></typeparam>
+		/// <returns>size_t</returns>
+		template<auto GenericFieldPointer> static inline constexpr std::size_t referToFieldIndex() noexcept
+		{
+			constexpr bool matches[] = {SafeFieldwiseMemoryChunk::matchField<GenericFieldPointer,GenericFieldPointers>()...};
+			std::size_t i = 0;
+
+			for (i = 0;i < sizeof...(GenericFieldPointers);i++)
+			{
+				if (matches[i] == true)
+				{
+					return i;
+				}
+			}
+
+			return sizeof...(GenericFieldPointers);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		constexpr
+		///		noexcept
+		/// </summary>
+		/// <param name="cardinality"></param>
+		/// <param name="fieldSize"></param>
+		/// <returns>size_t</returns>
+		static inline constexpr std::size_t computeFieldBufferSize(const std::size_t& cardinality,const std::size_t& fieldSize) noexcept
+		{
+			std::size_t bufferSize = cardinality * fieldSize;
+
+			return ((bufferSize + SafeFieldwiseMemoryChunk::fieldAlignment - 1) / SafeFieldwiseMemoryChunk::fieldAlignment) * SafeFieldwiseMemoryChunk::fieldAlignment;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericFieldPointer"></typeparam>
+		/// <param name="prototype"></param>
+		/// <returns>void</returns>
+		template<auto GenericFieldPointer> inline void initializeFieldBuffer(const GenericTypeOfSafeContextDerivative& prototype)
+		{
+			typedef typename SafeFieldTraits<decltype(GenericFieldPointer)>::SafeFieldType SafeFieldType;
+
+			SafeFieldType* fieldBufferPointer = static_cast<SafeFieldType*>(::operator new(SafeFieldwiseMemoryChunk::computeFieldBufferSize(this->cardinality,sizeof(SafeFieldType)),std::align_val_t(SafeFieldwiseMemoryChunk::fieldAlignment)));
+
+			try
+			{
+				std::uninitialized_fill_n(fieldBufferPointer,this->cardinality,prototype.*GenericFieldPointer);
+			}
+			catch (...)
+			{
+				::operator delete(static_cast<void*>(fieldBufferPointer),std::align_val_t(SafeFieldwiseMemoryChunk::fieldAlignment));
+				throw;
+			}
+
+			std::get<SafeFieldwiseMemoryChunk::referToFieldIndex<GenericFieldPointer>()>(this->fieldBufferPointers) = fieldBufferPointer;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <typeparam name="GenericFieldPointer"></typeparam>
+		/// <returns>void</returns>
+		template<auto GenericFieldPointer> inline void releaseFieldBuffer() noexcept
+		{
+			auto& fieldBufferPointer = std::get<SafeFieldwiseMemoryChunk::referToFieldIndex<GenericFieldPointer>()>(this->fieldBufferPointers);
+
+			if (fieldBufferPointer != nullptr)
+			{
+				std::destroy_n(fieldBufferPointer,this->cardinality);
+				::operator delete(static_cast<void*>(fieldBufferPointer),std::align_val_t(SafeFieldwiseMemoryChunk::fieldAlignment));
+				fieldBufferPointer = nullptr;
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="index"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		inline void checkIndex(const std::size_t& index) const
+		{
+			if (index >= this->cardinality)
+			{
+				throw SafeContextException("Argument `index` is out of bound: `" + std::to_string(index) + "` while the cardinality is `" + std::to_string(this->cardinality) + "`!");
+			}
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeFieldwiseMemoryChunk`.
+		/// </summary>
+		/// <param name="cardinality"></param>
+		inline explicit SafeFieldwiseMemoryChunk(const std::size_t& cardinality) : SafeContextBase()
+		{
+			const GenericTypeOfSafeContextDerivative prototype{};
+
+			this->cardinality = cardinality;
+			this->fieldBufferPointers = std::tuple<typename SafeFieldTraits<decltype(GenericFieldPointers)>::SafeFieldType*...>();
+
+			try
+			{
+				(this->initializeFieldBuffer<GenericFieldPointers>(prototype),...);
+			}
+			catch (...)
+			{
+				(this->releaseFieldBuffer<GenericFieldPointers>(),...);
+				throw;
+			}
+		};
+
+		/// <summary>
+		///		Constructor of `SafeFieldwiseMemoryChunk`.
+		/// </summary>
+		inline explicit SafeFieldwiseMemoryChunk() : SafeFieldwiseMemoryChunk(10)
+		{
+
+		};
+
+	private:
+		/// <summary>
+		///		Copy constructor of `SafeFieldwiseMemoryChunk`.
+		/// </summary>
+		inline SafeFieldwiseMemoryChunk(const SafeFieldwiseMemoryChunk&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeFieldwiseMemoryChunk`.
+		/// </summary>
+		inline SafeFieldwiseMemoryChunk(SafeFieldwiseMemoryChunk&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeFieldwiseMemoryChunk`.
+		/// </summary>
+		inline virtual ~SafeFieldwiseMemoryChunk() noexcept(false) override
+		{
+			(this->releaseFieldBuffer<GenericFieldPointers>(),...);
+		};
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeFieldwiseMemoryChunk&amp;</returns>
+		inline SafeFieldwiseMemoryChunk& operator=(const SafeFieldwiseMemoryChunk&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeFieldwiseMemoryChunk&amp;</returns>
+		inline SafeFieldwiseMemoryChunk& operator=(SafeFieldwiseMemoryChunk&&) = delete;
+
+	public:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator[]
+		/// </summary>
+		/// <param name="index"></param>
+		/// <returns>SafeConstantFieldwiseView</returns>
+		/// <exception cref="SafeContextException"/>
+		inline SafeConstantFieldwiseView operator[](const std::size_t& index) const
+		{
+			this->checkIndex(index);
+
+			return SafeConstantFieldwiseView(*this,index);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator[]
+		/// </summary>
+		/// <param name="index"></param>
+		/// <returns>SafeFieldwiseView</returns>
+		/// <exception cref="SafeContextException"/>
+		inline SafeFieldwiseView operator[](const std::size_t& index)
+		{
+			this->checkIndex(index);
+
+			return SafeFieldwiseView(*this,index);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <typeparam name="GenericFieldPointer"></typeparam>
+		/// <returns>SafeFieldType*</returns>
+		template<auto GenericFieldPointer> inline typename SafeFieldTraits<decltype(GenericFieldPointer)>::SafeFieldType* getFieldBuffer() noexcept
+		{
+			static_assert((SafeFieldwiseMemoryChunk::referToFieldIndex<GenericFieldPointer>() < sizeof...(GenericFieldPointers)),"`GenericFieldPointer` isn't one of the fields of this chunk!");
+
+			return std::get<SafeFieldwiseMemoryChunk::referToFieldIndex<GenericFieldPointer>()>(this->fieldBufferPointers);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <typeparam name="GenericFieldPointer"></typeparam>
+		/// <returns>SafeFieldType*</returns>
+		template<auto GenericFieldPointer> inline const typename SafeFieldTraits<decltype(GenericFieldPointer)>::SafeFieldType* getFieldBuffer() const noexcept
+		{
+			static_assert((SafeFieldwiseMemoryChunk::referToFieldIndex<GenericFieldPointer>() < sizeof...(GenericFieldPointers)),"`GenericFieldPointer` isn't one of the fields of this chunk!");
+
+			return std::get<SafeFieldwiseMemoryChunk::referToFieldIndex<GenericFieldPointer>()>(this->fieldBufferPointers);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getCardinality() const noexcept
+		{
+			return this->cardinality;
+		};
+	};
+
+	/// <summary>
+	///		C++ class: `SafeConstantFieldwiseView`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	/// <typeparam name="...GenericFieldPointers"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative,auto ...GenericFieldPointers> class SafeFieldwiseMemoryChunk<GenericTypeOfSafeContextDerivative,GenericFieldPointers...>::SafeConstantFieldwiseView
+	{
+	private:
+		const SafeFieldwiseMemoryChunk<GenericTypeOfSafeContextDerivative,GenericFieldPointers...>* chunkPointer;
+		std::size_t index;
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeConstantFieldwiseView`.
+		/// </summary>
+		/// <param name="chunkReference"></param>
+		/// <param name="index"></param>
+		inline explicit SafeConstantFieldwiseView(const SafeFieldwiseMemoryChunk<GenericTypeOfSafeContextDerivative,GenericFieldPointers...>& chunkReference,const std::size_t& index) noexcept
+		{
+			this->chunkPointer = std::addressof(chunkReference);
+			this->index = index;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <typeparam name="GenericFieldPointer"></typeparam>
+		/// <returns>SafeFieldType&amp;</returns>
+		template<auto GenericFieldPointer> inline const typename SafeFieldTraits<decltype(GenericFieldPointer)>::SafeFieldType& get() const noexcept
+		{
+			return ((this->chunkPointer)->template getFieldBuffer<GenericFieldPointer>())[this->index];
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>GenericTypeOfSafeContextDerivative</returns>
+		inline GenericTypeOfSafeContextDerivative materialize() const
+		{
+			GenericTypeOfSafeContextDerivative instance{};
+
+			((instance.*GenericFieldPointers = this->get<GenericFieldPointers>()),...);
+
+			return instance;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator GenericTypeOfSafeContextDerivative
+		/// </summary>
+		/// <returns>GenericTypeOfSafeContextDerivative</returns>
+		inline operator GenericTypeOfSafeContextDerivative() const
+		{
+			return this->materialize();
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getIndex() const noexcept
+		{
+			return this->index;
+		};
+	};
+
+	/// <summary>
+	///		C++ class: `SafeFieldwiseView`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	/// <typeparam name="...GenericFieldPointers"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative,auto ...GenericFieldPointers> class SafeFieldwiseMemoryChunk<GenericTypeOfSafeContextDerivative,GenericFieldPointers...>::SafeFieldwiseView
+	{
+	private:
+		SafeFieldwiseMemoryChunk<GenericTypeOfSafeContextDerivative,GenericFieldPointers...>* chunkPointer;
+		std::size_t index;
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeFieldwiseView`.
+		/// </summary>
+		/// <param name="chunkReference"></param>
+		/// <param name="index"></param>
+		inline explicit SafeFieldwiseView(SafeFieldwiseMemoryChunk<GenericTypeOfSafeContextDerivative,GenericFieldPointers...>& chunkReference,const std::size_t& index) noexcept
+		{
+			this->chunkPointer = std::addressof(chunkReference);
+			this->index = index;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <param name="instance"></param>
+		/// <returns>SafeFieldwiseView&amp;</returns>
+		inline SafeFieldwiseView& operator=(const GenericTypeOfSafeContextDerivative& instance)
+		{
+			((this->get<GenericFieldPointers>() = instance.*GenericFieldPointers),...);
+
+			return *this;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <typeparam name="GenericFieldPointer"></typeparam>
+		/// <returns>SafeFieldType&amp;</returns>
+		template<auto GenericFieldPointer> inline typename SafeFieldTraits<decltype(GenericFieldPointer)>::SafeFieldType& get() const noexcept
+		{
+			return ((this->chunkPointer)->template getFieldBuffer<GenericFieldPointer>())[this->index];
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>GenericTypeOfSafeContextDerivative</returns>
+		inline GenericTypeOfSafeContextDerivative materialize() const
+		{
+			GenericTypeOfSafeContextDerivative instance{};
+
+			((instance.*GenericFieldPointers = this->get<GenericFieldPointers>()),...);
+
+			return instance;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator GenericTypeOfSafeContextDerivative
+		/// </summary>
+		/// <returns>GenericTypeOfSafeContextDerivative</returns>
+		inline operator GenericTypeOfSafeContextDerivative() const
+		{
+			return this->materialize();
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		///		operator SafeConstantFieldwiseView
+		/// </summary>
+		/// <returns>SafeConstantFieldwiseView</returns>
+		inline operator SafeConstantFieldwiseView() const noexcept
+		{
+			return SafeConstantFieldwiseView(*(this->chunkPointer),this->index);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getIndex() const noexcept
+		{
+			return this->index;
+		};
+	};
+};
\ No newline at end of file
@@ -121,9 +121,9 @@ namespace Safe
 		///		Move constructor of `SafeFunction`.
 		/// </summary>
 		/// <param name="other"></param>
-		inline SafeFunction(SafeFunction<GenericTypeOfReturn(GenericTypesOfArguments...)>&& other) noexcept(false) : SafeContextBase(static_cast<SafeContextBase&&>(other))
+		inline SafeFunction(SafeFunction<GenericTypeOfReturn(GenericTypesOfArguments...)>&& other) noexcept(false) : SafeContextBase(static_cast<SafeContextBase&&>(other)),composedData(static_cast<std::function<GenericTypeOfReturn(GenericTypesOfArguments...)>&&>(other.composedData))
 		{
-			this->composedData = static_cast<std::function<GenericTypeOfReturn(GenericTypesOfArguments...)>&&>(other.composedData);
+			other.composedData = nullptr;
 		};
 
 		/// <summary>
@@ -149,15 +149,16 @@ namespace Safe
 		/// <summary>
 		///		dynamic
 		///		inline
-		///		noexcept(false)
+		///		noexcept
 		///		operator=
 		/// </summary>
 		/// <param name="other"></param>
 		/// <returns>SafeFunction&lt;GenericTypeOfReturn,GenericTypesOfArguments...&gt;&amp;</returns>
-		inline SafeFunction<GenericTypeOfReturn(GenericTypesOfArguments...)>& operator=(SafeFunction<GenericTypeOfReturn(GenericTypesOfArguments...)>&& other) noexcept(false)
+		inline SafeFunction<GenericTypeOfReturn(GenericTypesOfArguments...)>& operator=(SafeFunction<GenericTypeOfReturn(GenericTypesOfArguments...)>&& other) noexcept
 		{
 			SafeContextBase::operator=(static_cast<SafeContextBase&&>(other));
-			this->composedData = static_cast<std::function<GenericTypeOfReturn(GenericTypesOfArguments...)>&&>(other.composedData);
+			(this->composedData).swap(other.composedData);
+			other.composedData = nullptr;
 
 			return *this;
 		};
@@ -0,0 +1,141 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextBase.h"
+#include "SafeContextException.h"
+#include "SafeImageStamp.h"
+#include "SafeTraits.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	template<typename GenericTypeOfSafeContextDerivative> class SafeContext;
+
+	/// <summary>
+	///		C++ class template: `SafeImagePrototype`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> class SafeContextBase::SafeImagePrototype final
+	{
+		static_assert((std::is_base_of<SafeContextBase,GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type inherited from `SafeContextBase`!");
+		static_assert((SafeTriviallyRelocatable<GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be declared trivially relocatable through `SafeTriviallyRelocatable` to be copied from its image!");
+		static_assert((std::is_base_of<SafeContext<GenericTypeOfSafeContextDerivative>,GenericTypeOfSafeContextDerivative>::value == false),"`GenericTypeOfSafeContextDerivative` can't inherit `SafeContext` to be copied from its image, because its constructor wouldn't run!");
+
+	private:
+		const GenericTypeOfSafeContextDerivative* prototypePointer;
+
+
+		/// <summary>
+		///		Constructor of `SafeImagePrototype`.
+		/// </summary>
+		/// <exception cref="SafeContextException"/>
+		inline explicit SafeImagePrototype() : prototypePointer(SafeContextBase::referToProxyInstancesOfDerivedType<GenericTypeOfSafeContextDerivative>().constantProxyInstancePointer)
+		{
+			if (static_cast<const void*>(static_cast<const SafeContextBase*>(this->prototypePointer)) != static_cast<const void*>(this->prototypePointer))
+			{
+				throw SafeContextException("`SafeContextBase` must be the first base of a type copied from its image!");
+			}
+		};
+
+		/// <summary>
+		///		Copy constructor of `SafeImagePrototype`.
+		/// </summary>
+		inline SafeImagePrototype(const SafeImagePrototype&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeImagePrototype`.
+		/// </summary>
+		inline SafeImagePrototype(SafeImagePrototype&&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeImagePrototype&amp;</returns>
+		inline SafeImagePrototype& operator=(const SafeImagePrototype&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeImagePrototype&amp;</returns>
+		inline SafeImagePrototype& operator=(SafeImagePrototype&&) = delete;
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>const SafeImagePrototype&amp;</returns>
+		/// <exception cref="SafeContextException"/>
+		static inline const SafeImagePrototype& referToPrototype()
+		{
+			static const SafeImagePrototype prototype;
+
+			return prototype;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="instancePointer"></param>
+		/// <returns>void</returns>
+		static inline void constructBase(SafeContextBase* const instancePointer)
+		{
+			const void* const prototypePointer = static_cast<const void*>(SafeImagePrototype::referToPrototype().prototypePointer);
+
+			::new(static_cast<void*>(instancePointer)) SafeContextBase();
+			std::memcpy(static_cast<void*>(instancePointer),prototypePointer,sizeof(void*));
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="bufferPointer"></param>
+		/// <param name="stride"></param>
+		/// <param name="cardinality"></param>
+		/// <returns>void</returns>
+		inline void stampImage(void* const bufferPointer,const std::size_t& stride,const std::size_t& cardinality) const
+		{
+			std::vector<unsigned char> image = std::vector<unsigned char>(stride,0);
+
+			std::memcpy(static_cast<void*>(image.data()),static_cast<const void*>(this->prototypePointer),sizeof(GenericTypeOfSafeContextDerivative));
+			SafeImageStamp::stamp(bufferPointer,static_cast<const void*>(image.data()),stride,cardinality);
+		};
+	};
+};
@@ -0,0 +1,193 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <cstddef>
+#include <cstring>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeNamespace.h"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#define CPP_SAFE_IMAGE_AVX512
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define CPP_SAFE_IMAGE_AVX2
+#endif
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class: `SafeImageStamp`.
+	/// </summary>
+	class SafeImageStamp final
+	{
+	private:
+		static constexpr std::size_t maximumLaneCount = 8;
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="destinationPointer"></param>
+		/// <param name="imagePointer"></param>
+		/// <param name="stride"></param>
+		/// <param name="count"></param>
+		/// <returns>void</returns>
+		static inline void stampScalar(unsigned char* const destinationPointer,const unsigned char* const imagePointer,const std::size_t& stride,const std::size_t& count) noexcept
+		{
+			std::size_t stampedCount = 1;
+
+			std::memcpy(destinationPointer,imagePointer,stride);
+
+			while (stampedCount < count)
+			{
+				std::size_t copiedCount = (((count - stampedCount) < stampedCount) ? (count - stampedCount) : stampedCount);
+
+				std::memcpy(destinationPointer + (stampedCount * stride),destinationPointer,copiedCount * stride);
+				stampedCount += copiedCount;
+			}
+		};
+
+#ifdef CPP_SAFE_IMAGE_AVX512
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="destinationPointer"></param>
+		/// <param name="imagePointer"></param>
+		/// <param name="stride"></param>
+		/// <param name="count"></param>
+		/// <returns>void</returns>
+		static inline void stampWide(unsigned char* const destinationPointer,const unsigned char* const imagePointer,const std::size_t& stride,const std::size_t& count) noexcept
+		{
+			__m512i lanes[SafeImageStamp::maximumLaneCount];
+			std::size_t laneCount = stride / sizeof(__m512i);
+			std::size_t i = 0;
+			std::size_t j = 0;
+
+			for (j = 0;j < laneCount;j++)
+			{
+				lanes[j] = _mm512_loadu_si512(static_cast<const void*>(imagePointer + (j * sizeof(__m512i))));
+			}
+
+			for (i = 0;i < count;i++)
+			{
+				unsigned char* elementPointer = destinationPointer + (i * stride);
+
+				for (j = 0;j < laneCount;j++)
+				{
+					_mm512_storeu_si512(static_cast<void*>(elementPointer + (j * sizeof(__m512i))),lanes[j]);
+				}
+			}
+		};
+#elif defined(CPP_SAFE_IMAGE_AVX2)
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="destinationPointer"></param>
+		/// <param name="imagePointer"></param>
+		/// <param name="stride"></param>
+		/// <param name="count"></param>
+		/// <returns>void</returns>
+		static inline void stampWide(unsigned char* const destinationPointer,const unsigned char* const imagePointer,const std::size_t& stride,const std::size_t& count) noexcept
+		{
+			__m256i lanes[SafeImageStamp::maximumLaneCount];
+			std::size_t laneCount = stride / sizeof(__m256i);
+			std::size_t i = 0;
+			std::size_t j = 0;
+
+			for (j = 0;j < laneCount;j++)
+			{
+				lanes[j] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(imagePointer + (j * sizeof(__m256i))));
+			}
+
+			for (i = 0;i < count;i++)
+			{
+				unsigned char* elementPointer = destinationPointer + (i * stride);
+
+				for (j = 0;j < laneCount;j++)
+				{
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(elementPointer + (j * sizeof(__m256i))),lanes[j]);
+				}
+			}
+		};
+#endif
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline constexpr std::size_t getLaneSize() noexcept
+		{
+#ifdef CPP_SAFE_IMAGE_AVX512
+			return sizeof(__m512i);
+#elif defined(CPP_SAFE_IMAGE_AVX2)
+			return sizeof(__m256i);
+#else
+			return 0;
+#endif
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="destinationPointer"></param>
+		/// <param name="imagePointer"></param>
+		/// <param name="stride"></param>
+		/// <param name="count"></param>
+		/// <returns>void</returns>
+		static inline void stamp(void* const destinationPointer,const void* const imagePointer,const std::size_t& stride,const std::size_t& count) noexcept
+		{
+			if ((count == 0) || (stride == 0))
+			{
+				return;
+			}
+
+#if defined(CPP_SAFE_IMAGE_AVX512) || defined(CPP_SAFE_IMAGE_AVX2)
+			if (((stride % SafeImageStamp::getLaneSize()) == 0) && (stride <= (SafeImageStamp::getLaneSize() * SafeImageStamp::maximumLaneCount)))
+			{
+				SafeImageStamp::stampWide(static_cast<unsigned char*>(destinationPointer),static_cast<const unsigned char*>(imagePointer),stride,count);
+
+				return;
+			}
+#endif
+
+			SafeImageStamp::stampScalar(static_cast<unsigned char*>(destinationPointer),static_cast<const unsigned char*>(imagePointer),stride,count);
+		};
+	};
+};
\ No newline at end of file
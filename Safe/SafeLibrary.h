@@ -0,0 +1,55 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "Safe.h"
+#include "SafeAdaptivePool.h"
+#include "SafeAlignment.h"
+#include "SafeArrayBins.h"
+#include "SafeChunkSerializer.h"
+#include "SafeCompactingHeap.h"
+#include "SafeConcurrentMemoryChunk.h"
+#include "SafeContext.h"
+#include "SafeContextBase.h"
+#include "SafeContextException.h"
+#include "SafeContextPolicy.h"
+#include "SafeContextStatistics.h"
+#include "SafeEpochGuard.h"
+#include "SafeEvent.h"
+#include "SafeEventAwaiter.h"
+#include "SafeEventQueue.h"
+#include "SafeEventScheduler.h"
+#include "SafeFieldwiseMemoryChunk.h"
+#include "SafeFunction.h"
+#include "SafeImagePrototype.h"
+#include "SafeImageStamp.h"
+#include "SafeLifetimeReport.h"
+#include "SafeLiveDirectory.h"
+#include "SafeMappedMemoryChunk.h"
+#include "SafeMemoryChunk.h"
+#include "SafeNamespace.h"
+#include "SafeParallel.h"
+#include "SafeRegion.h"
+#include "SafeTrace.h"
+#include "SafeTrade.h"
+#include "SafeTraits.h"
+#include "SafeTypeIdentity.h"
+#include "SafeWarmUp.h"
\ No newline at end of file
@@ -0,0 +1,518 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <sstream>
+#include <string>
+#if defined(__has_include)
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define CPP_SAFE_DEMANGLING
+#endif
+#endif
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextStatistics.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class: `SafeLifetimeSampler`.
+	/// </summary>
+	class SafeLifetimeSampler final
+	{
+	private:
+		static constexpr std::size_t slotCount = 65536;
+		static constexpr std::size_t probeLength = 16;
+
+		/// <summary>
+		///		C++ structure: `SafeLifetimeSample`.
+		/// </summary>
+		struct SafeLifetimeSample
+		{
+			std::atomic<std::uintptr_t> instanceAddress;
+			std::atomic<const SafeTypeStatistics*> statisticsPointer;
+			std::atomic<std::uint64_t> birthNanoseconds;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>uintptr_t</returns>
+		static inline std::uintptr_t getReservedAddress() noexcept
+		{
+			return 1;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>uintptr_t</returns>
+		static inline std::uintptr_t getReleasedAddress() noexcept
+		{
+			return 2;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>atomic&lt;uint32_t&gt;&amp;</returns>
+		static inline std::atomic<std::uint32_t>& referToSamplingPeriod() noexcept
+		{
+			static std::atomic<std::uint32_t> samplingPeriod(0);
+
+			return samplingPeriod;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>atomic&lt;SafeLifetimeSample*&gt;&amp;</returns>
+		static inline std::atomic<SafeLifetimeSample*>& referToSlotsPointer() noexcept
+		{
+			static std::atomic<SafeLifetimeSample*> slotsPointer(nullptr);
+
+			return slotsPointer;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="instancePointer"></param>
+		/// <returns>size_t</returns>
+		static inline std::size_t locateSlot(const void* const instancePointer) noexcept
+		{
+			std::uint64_t mixedAddress = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(instancePointer) >> 4) * static_cast<std::uint64_t>(0x9E3779B97F4A7C15ULL);
+
+			return static_cast<std::size_t>(mixedAddress >> 48);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		static inline std::uint64_t getCurrentNanoseconds() noexcept
+		{
+			return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="samplingPeriod"></param>
+		/// <returns>bool</returns>
+		static inline bool setSamplingPeriod(const std::uint32_t& samplingPeriod) noexcept
+		{
+			if ((samplingPeriod != 0) && (SafeLifetimeSampler::referToSlotsPointer().load(std::memory_order_acquire) == nullptr))
+			{
+				SafeLifetimeSample* slotsPointer = new(std::nothrow) SafeLifetimeSample[SafeLifetimeSampler::slotCount]();
+				SafeLifetimeSample* expectedSlotsPointer = nullptr;
+
+				if (slotsPointer == nullptr)
+				{
+					return false;
+				}
+
+				if (SafeLifetimeSampler::referToSlotsPointer().compare_exchange_strong(expectedSlotsPointer,slotsPointer,std::memory_order_acq_rel) == false)
+				{
+					delete[] slotsPointer;
+				}
+			}
+
+			SafeLifetimeSampler::referToSamplingPeriod().store(samplingPeriod,std::memory_order_relaxed);
+
+			return true;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>uint32_t</returns>
+		static inline std::uint32_t getSamplingPeriod() noexcept
+		{
+			return SafeLifetimeSampler::referToSamplingPeriod().load(std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="instancePointer"></param>
+		/// <param name="statisticsReference"></param>
+		/// <returns>void</returns>
+		static inline void sample(const void* const instancePointer,const SafeTypeStatistics& statisticsReference) noexcept
+		{
+			static thread_local std::uint32_t countdown = 0;
+			std::uint32_t samplingPeriod = SafeLifetimeSampler::getSamplingPeriod();
+
+			if (samplingPeriod == 0)
+			{
+				return;
+			}
+
+			if (countdown > 1)
+			{
+				countdown--;
+
+				return;
+			}
+
+			countdown = samplingPeriod;
+
+			SafeLifetimeSample* slotsPointer = SafeLifetimeSampler::referToSlotsPointer().load(std::memory_order_acquire);
+			std::size_t slotIndex = SafeLifetimeSampler::locateSlot(instancePointer);
+			std::size_t i = 0;
+
+			if (slotsPointer == nullptr)
+			{
+				return;
+			}
+
+			for (i = 0;i < SafeLifetimeSampler::probeLength;i++)
+			{
+				SafeLifetimeSample& slotReference = slotsPointer[(slotIndex + i) & (SafeLifetimeSampler::slotCount - 1)];
+				std::uintptr_t expectedAddress = slotReference.instanceAddress.load(std::memory_order_relaxed);
+
+				if (((expectedAddress == 0) || (expectedAddress == SafeLifetimeSampler::getReleasedAddress())) && (slotReference.instanceAddress.compare_exchange_strong(expectedAddress,SafeLifetimeSampler::getReservedAddress(),std::memory_order_acquire,std::memory_order_relaxed) == true))
+				{
+					slotReference.statisticsPointer.store(std::addressof(statisticsReference),std::memory_order_relaxed);
+					slotReference.birthNanoseconds.store(SafeLifetimeSampler::getCurrentNanoseconds(),std::memory_order_relaxed);
+					slotReference.instanceAddress.store(reinterpret_cast<std::uintptr_t>(instancePointer),std::memory_order_release);
+
+					return;
+				}
+			}
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="instancePointer"></param>
+		/// <returns>void</returns>
+		static inline void release(const void* const instancePointer) noexcept
+		{
+			SafeLifetimeSample* slotsPointer = SafeLifetimeSampler::referToSlotsPointer().load(std::memory_order_acquire);
+			std::size_t slotIndex = SafeLifetimeSampler::locateSlot(instancePointer);
+			std::uintptr_t instanceAddress = reinterpret_cast<std::uintptr_t>(instancePointer);
+			std::size_t i = 0;
+
+			if (slotsPointer == nullptr)
+			{
+				return;
+			}
+
+			for (i = 0;i < SafeLifetimeSampler::probeLength;i++)
+			{
+				SafeLifetimeSample& slotReference = slotsPointer[(slotIndex + i) & (SafeLifetimeSampler::slotCount - 1)];
+				std::uintptr_t expectedAddress = instanceAddress;
+
+				if (slotReference.instanceAddress.compare_exchange_strong(expectedAddress,SafeLifetimeSampler::getReleasedAddress(),std::memory_order_release,std::memory_order_relaxed) == true)
+				{
+					return;
+				}
+				else if (expectedAddress == 0)
+				{
+					return;
+				}
+			}
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfFunction"></typeparam>
+		/// <param name="function"></param>
+		/// <returns>void</returns>
+		template<typename GenericTypeOfFunction> static inline void forEachSample(GenericTypeOfFunction&& function)
+		{
+			SafeLifetimeSample* slotsPointer = SafeLifetimeSampler::referToSlotsPointer().load(std::memory_order_acquire);
+			std::uint64_t currentNanoseconds = SafeLifetimeSampler::getCurrentNanoseconds();
+			std::size_t i = 0;
+
+			if (slotsPointer == nullptr)
+			{
+				return;
+			}
+
+			for (i = 0;i < SafeLifetimeSampler::slotCount;i++)
+			{
+				std::uintptr_t instanceAddress = slotsPointer[i].instanceAddress.load(std::memory_order_acquire);
+
+				if (instanceAddress > SafeLifetimeSampler::getReleasedAddress())
+				{
+					std::uint64_t birthNanoseconds = slotsPointer[i].birthNanoseconds.load(std::memory_order_relaxed);
+
+					function(*(slotsPointer[i].statisticsPointer.load(std::memory_order_relaxed)),std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>((currentNanoseconds > birthNanoseconds) ? (currentNanoseconds - birthNanoseconds) : 0)));
+				}
+			}
+		};
+	};
+
+	/// <summary>
+	///		C++ class: `SafeLifetimeReport`.
+	/// </summary>
+	class SafeLifetimeReport final
+	{
+	private:
+		static constexpr std::size_t ageBucketCount = 7;
+
+		/// <summary>
+		///		C++ structure: `SafeLifetimeDigest`.
+		/// </summary>
+		struct SafeLifetimeDigest
+		{
+			std::uint64_t ageBuckets[SafeLifetimeReport::ageBucketCount];
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>string&amp;</returns>
+		static inline std::string& referToExitReportPath()
+		{
+			static std::string exitReportPath = std::string();
+
+			return exitReportPath;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="age"></param>
+		/// <returns>size_t</returns>
+		static inline std::size_t locateAgeBucket(const std::chrono::nanoseconds& age) noexcept
+		{
+			static const std::chrono::nanoseconds ageBucketLimits[SafeLifetimeReport::ageBucketCount - 1] = {std::chrono::milliseconds(1),std::chrono::milliseconds(10),std::chrono::milliseconds(100),std::chrono::seconds(1),std::chrono::seconds(10),std::chrono::seconds(60)};
+			std::size_t i = 0;
+
+			for (i = 0;i < SafeLifetimeReport::ageBucketCount - 1;i++)
+			{
+				if (age < ageBucketLimits[i])
+				{
+					return i;
+				}
+			}
+
+			return SafeLifetimeReport::ageBucketCount - 1;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="typeInformation"></param>
+		/// <returns>string</returns>
+		static inline std::string getTypeName(const std::type_info& typeInformation)
+		{
+#ifdef CPP_SAFE_DEMANGLING
+			int demanglingStatus = 0;
+			char* demangledName = abi::__cxa_demangle(typeInformation.name(),nullptr,nullptr,&demanglingStatus);
+
+			if ((demanglingStatus == 0) && (demangledName != nullptr))
+			{
+				std::string typeName = std::string(demangledName);
+
+				std::free(demangledName);
+
+				return typeName;
+			}
+#endif
+
+			return std::string(typeInformation.name());
+		};
+
+		/// <summary>
+		///		static
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		static void writeAtExit() noexcept
+		{
+			try
+			{
+				const std::string& exitReportPath = SafeLifetimeReport::referToExitReportPath();
+
+				if (exitReportPath.empty() == true)
+				{
+					SafeLifetimeReport::write(std::cerr);
+				}
+				else
+				{
+					std::ofstream exitReportStream = std::ofstream(exitReportPath,std::ios::out | std::ios::trunc);
+
+					SafeLifetimeReport::write(exitReportStream);
+				}
+			}
+			catch (...)
+			{
+
+			}
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="stream"></param>
+		/// <returns>void</returns>
+		static inline void write(std::ostream& stream)
+		{
+			static const char* const ageBucketNames[SafeLifetimeReport::ageBucketCount] = {"<1ms","<10ms","<100ms","<1s","<10s","<1min",">=1min"};
+			std::map<const SafeTypeStatistics*,SafeLifetimeDigest> digests = std::map<const SafeTypeStatistics*,SafeLifetimeDigest>();
+			std::size_t i = 0;
+
+			SafeLifetimeSampler::forEachSample([&digests](const SafeTypeStatistics& statisticsReference,const std::chrono::nanoseconds& age) -> void
+			{
+				SafeLifetimeDigest& digestReference = digests[std::addressof(statisticsReference)];
+
+				digestReference.ageBuckets[SafeLifetimeReport::locateAgeBucket(age)]++;
+			});
+
+			stream << "Safe lifetime report" << std::endl;
+
+			SafeContextStatistics::forEachTypeStatistics([&stream,&digests,&i](const SafeTypeStatistics& statisticsReference) -> void
+			{
+				std::uint64_t liveCount = statisticsReference.getLiveCount();
+				std::uint64_t liveChunkCount = statisticsReference.getLiveChunkCount();
+				std::map<const SafeTypeStatistics*,SafeLifetimeDigest>::const_iterator digestIterator = digests.find(std::addressof(statisticsReference));
+
+				if ((liveCount == 0) && (liveChunkCount == 0) && (digestIterator == digests.end()))
+				{
+					return;
+				}
+
+				stream << "  " << SafeLifetimeReport::getTypeName(statisticsReference.getTypeInfo()) << ": " << liveCount << " live (" << (liveCount * statisticsReference.getInstanceSize()) << " bytes) of " << statisticsReference.getConstructedCount() << " constructed, " << liveChunkCount << " live chunk(s) (" << statisticsReference.getLiveChunkSize() << " bytes)" << std::endl;
+
+				if (digestIterator != digests.end())
+				{
+					stream << "    sampled ages:";
+
+					for (i = 0;i < SafeLifetimeReport::ageBucketCount;i++)
+					{
+						stream << " " << ageBucketNames[i] << "=" << (digestIterator->second).ageBuckets[i];
+					}
+
+					stream << std::endl;
+				}
+			});
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>string</returns>
+		static inline std::string format()
+		{
+			std::ostringstream stream = std::ostringstream();
+
+			SafeLifetimeReport::write(stream);
+
+			return stream.str();
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="exitReportPath"></param>
+		/// <returns>void</returns>
+		static inline void enableAtExit(const std::string& exitReportPath = std::string())
+		{
+			std::string& exitReportPathReference = SafeLifetimeReport::referToExitReportPath();
+			static const bool registration = (std::atexit(&SafeLifetimeReport::writeAtExit) == 0);
+
+			exitReportPathReference = exitReportPath;
+			static_cast<void>(registration);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>bool</returns>
+		static inline bool initializeFromEnvironment()
+		{
+			static const bool initialization = []() -> bool
+			{
+				const char* exitReportValue = std::getenv("CPP_SAFE_LIFETIME_REPORT");
+				const char* samplingValue = std::getenv("CPP_SAFE_LIFETIME_SAMPLING");
+
+				if ((samplingValue != nullptr) && (std::strtoul(samplingValue,nullptr,10) > 0) && (SafeLifetimeSampler::getSamplingPeriod() == 0))
+				{
+					SafeLifetimeSampler::setSamplingPeriod(static_cast<std::uint32_t>(std::strtoul(samplingValue,nullptr,10)));
+				}
+
+				if ((exitReportValue != nullptr) && (std::string(exitReportValue).empty() == false) && (std::string(exitReportValue) != "0"))
+				{
+					SafeLifetimeReport::enableAtExit((std::string(exitReportValue) == "1") ? std::string() : std::string(exitReportValue));
+
+					return true;
+				}
+
+				return false;
+			}();
+
+			return initialization;
+		};
+	};
+};
\ No newline at end of file
@@ -0,0 +1,319 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextException.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class template: `SafeLiveDirectory`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> class SafeLiveDirectory final
+	{
+	public:
+		/// <summary>
+		///		C++ structure: `SafeLiveSlot`.
+		/// </summary>
+		struct SafeLiveSlot
+		{
+			std::atomic<GenericTypeOfSafeContextDerivative*> instancePointer;
+
+			/// <summary>
+			///		Constructor of `SafeLiveSlot`.
+			/// </summary>
+			/// <param name="instancePointer"></param>
+			inline explicit SafeLiveSlot(GenericTypeOfSafeContextDerivative* const instancePointer) noexcept : instancePointer(instancePointer)
+			{
+
+			};
+
+			/// <summary>
+			///		Copy constructor of `SafeLiveSlot`.
+			/// </summary>
+			/// <param name="other"></param>
+			inline SafeLiveSlot(const SafeLiveSlot& other) noexcept : instancePointer((other.instancePointer).load(std::memory_order_relaxed))
+			{
+
+			};
+
+			/// <summary>
+			///		dynamic
+			///		inline
+			///		noexcept
+			///		operator=
+			/// </summary>
+			/// <param name="other"></param>
+			/// <returns>SafeLiveSlot&amp;</returns>
+			inline SafeLiveSlot& operator=(const SafeLiveSlot& other) noexcept
+			{
+				(this->instancePointer).store((other.instancePointer).load(std::memory_order_relaxed),std::memory_order_relaxed);
+
+				return *this;
+			};
+		};
+
+	private:
+		std::mutex directoryMutex;
+		std::vector<SafeLiveSlot> instanceSlots;
+		std::vector<const void*> keyPointers;
+		std::unordered_map<const void*,std::size_t> instancePositions;
+		std::atomic<bool> compactionPending;
+
+
+		/// <summary>
+		///		Constructor of `SafeLiveDirectory`.
+		/// </summary>
+		inline explicit SafeLiveDirectory() : directoryMutex(),instanceSlots(),keyPointers(),instancePositions(),compactionPending(false)
+		{
+
+		};
+
+		/// <summary>
+		///		Copy constructor of `SafeLiveDirectory`.
+		/// </summary>
+		inline SafeLiveDirectory(const SafeLiveDirectory&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeLiveDirectory`.
+		/// </summary>
+		inline SafeLiveDirectory(SafeLiveDirectory&&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeLiveDirectory&amp;</returns>
+		inline SafeLiveDirectory& operator=(const SafeLiveDirectory&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeLiveDirectory&amp;</returns>
+		inline SafeLiveDirectory& operator=(SafeLiveDirectory&&) = delete;
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>bool&amp;</returns>
+		static inline bool& referToEnumeratingFlag() noexcept
+		{
+			static thread_local bool enumerating = false;
+
+			return enumerating;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="position"></param>
+		/// <returns>void</returns>
+		inline void removePosition(const std::size_t& position) noexcept
+		{
+			const void* keyPointer = (this->keyPointers)[position];
+			const void* lastKeyPointer = (this->keyPointers).back();
+
+			(this->instanceSlots)[position] = (this->instanceSlots).back();
+			(this->keyPointers)[position] = lastKeyPointer;
+			(this->instancePositions)[lastKeyPointer] = position;
+			(this->instanceSlots).pop_back();
+			(this->keyPointers).pop_back();
+			(this->instancePositions).erase(keyPointer);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		inline void compact() noexcept
+		{
+			std::size_t position = (this->instanceSlots).size();
+
+			if ((this->compactionPending).exchange(false,std::memory_order_acquire) == false)
+			{
+				return;
+			}
+
+			while (position > 0)
+			{
+				position--;
+
+				if ((((this->instanceSlots)[position]).instancePointer).load(std::memory_order_relaxed) == nullptr)
+				{
+					this->removePosition(position);
+				}
+			}
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>SafeLiveDirectory&amp;</returns>
+		static inline SafeLiveDirectory& referToDirectory()
+		{
+			static SafeLiveDirectory* directoryPointer = new SafeLiveDirectory();
+
+			return *directoryPointer;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="keyPointer"></param>
+		/// <param name="instancePointer"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		inline void enlist(const void* const keyPointer,GenericTypeOfSafeContextDerivative* const instancePointer)
+		{
+			if (SafeLiveDirectory::referToEnumeratingFlag() == true)
+			{
+				throw SafeContextException("Instances can't be constructed while their live directory is being enumerated!");
+			}
+
+			std::lock_guard<std::mutex> directoryLock(this->directoryMutex);
+
+			(this->instancePositions).emplace(keyPointer,(this->instanceSlots).size());
+			(this->instanceSlots).emplace_back(instancePointer);
+			(this->keyPointers).push_back(keyPointer);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="keyPointer"></param>
+		/// <returns>void</returns>
+		inline void delist(const void* const keyPointer) noexcept
+		{
+			typename std::unordered_map<const void*,std::size_t>::iterator positionIterator;
+
+			if (SafeLiveDirectory::referToEnumeratingFlag() == true)
+			{
+				positionIterator = (this->instancePositions).find(keyPointer);
+
+				if (positionIterator != (this->instancePositions).end())
+				{
+					(((this->instanceSlots)[positionIterator->second]).instancePointer).store(nullptr,std::memory_order_release);
+					(this->compactionPending).store(true,std::memory_order_release);
+				}
+
+				return;
+			}
+
+			std::lock_guard<std::mutex> directoryLock(this->directoryMutex);
+
+			positionIterator = (this->instancePositions).find(keyPointer);
+
+			if (positionIterator != (this->instancePositions).end())
+			{
+				this->removePosition(positionIterator->second);
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfFunction"></typeparam>
+		/// <param name="function"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		template<typename GenericTypeOfFunction> inline void enumerate(GenericTypeOfFunction&& function)
+		{
+			if (SafeLiveDirectory::referToEnumeratingFlag() == true)
+			{
+				throw SafeContextException("The live directory is already being enumerated!");
+			}
+
+			std::lock_guard<std::mutex> directoryLock(this->directoryMutex);
+
+			SafeLiveDirectory::markEnumerating(true);
+
+			try
+			{
+				function(static_cast<const SafeLiveSlot*>((this->instanceSlots).data()),(this->instanceSlots).size());
+			}
+			catch (...)
+			{
+				SafeLiveDirectory::markEnumerating(false);
+				this->compact();
+
+				throw;
+			}
+
+			SafeLiveDirectory::markEnumerating(false);
+			this->compact();
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="enumerating"></param>
+		/// <returns>bool</returns>
+		static inline bool markEnumerating(const bool& enumerating) noexcept
+		{
+			bool previousEnumerating = SafeLiveDirectory::referToEnumeratingFlag();
+
+			SafeLiveDirectory::referToEnumeratingFlag() = enumerating;
+
+			return previousEnumerating;
+		};
+
+		/// <summary>
+		///		dynamic
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getLiveCount()
+		{
+			std::lock_guard<std::mutex> directoryLock(this->directoryMutex);
+
+			return (this->instanceSlots).size();
+		};
+	};
+};
\ No newline at end of file
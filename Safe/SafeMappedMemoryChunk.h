@@ -0,0 +1,522 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeNamespace.h"
+
+#ifdef UNIX
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/** Inclusion(s) of system header file(s).**/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeAlignment.h"
+#include "SafeContextBase.h"
+#include "SafeContextException.h"
+#include "SafeImagePrototype.h"
+#include "SafeTraits.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class template: `SafeMappedMemoryChunk`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> class SafeContextBase::SafeMappedMemoryChunk final : public SafeContextBase
+	{
+	private:
+		/// <summary>
+		///		C++ structure: `SafeMappedHeader`.
+		/// </summary>
+		struct SafeMappedHeader
+		{
+			char signature[8];
+			std::uint64_t version;
+			std::uint64_t elementStride;
+			std::uint64_t cardinality;
+			std::uint64_t elementSize;
+			std::uint64_t elementAlignment;
+			std::uint64_t layoutVersion;
+		};
+
+
+		unsigned char* mappedPointer;
+		std::size_t mappedSize;
+		int fileDescriptor;
+		std::string filePath;
+		GenericTypeOfSafeContextDerivative* composedBufferPointer;
+		std::size_t cardinality;
+		std::vector<const void*> constantPointerMasks;
+		std::vector<void*> variablePointerMasks;
+
+	public:
+		static_assert((std::is_base_of<SafeContextBase,GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type inherited from `SafeContextBase`!");
+		static_assert((std::is_default_constructible<GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type having a default constructor!");
+		static_assert((std::is_copy_constructible<GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type having a copy constructor!");
+		static_assert((std::is_move_constructible<GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type having a move constructor!");
+		static_assert((std::is_copy_assignable<GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type having a copy assignment operator!");
+		static_assert((std::is_move_assignable<GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be a type having a move assignment operator!");
+		static_assert((std::is_pointer<GenericTypeOfSafeContextDerivative>::value == false),"`GenericTypeOfSafeContextDerivative` can't be a pointer type!");
+		static_assert((SafeTriviallyRelocatable<GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must be declared trivially relocatable through `SafeTriviallyRelocatable`!");
+
+
+		static constexpr std::size_t elementAlignment = SafeAlignedLayout<GenericTypeOfSafeContextDerivative>::alignment;
+		static constexpr std::size_t elementStride = SafeAlignedLayout<GenericTypeOfSafeContextDerivative>::stride;
+		static constexpr std::size_t headerSize = (((sizeof(SafeMappedHeader) > elementAlignment) ? sizeof(SafeMappedHeader) : elementAlignment) + elementAlignment - 1) / elementAlignment * elementAlignment;
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="index"></param>
+		/// <returns>GenericTypeOfSafeContextDerivative*</returns>
+		inline GenericTypeOfSafeContextDerivative* referToElementPointer(const std::size_t& index) const noexcept
+		{
+			return reinterpret_cast<GenericTypeOfSafeContextDerivative*>(reinterpret_cast<unsigned char*>(this->composedBufferPointer) + (index * SafeMappedMemoryChunk::elementStride));
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		inline void closeMapping() noexcept
+		{
+			if (this->mappedPointer != nullptr)
+			{
+				::munmap(this->mappedPointer,this->mappedSize);
+				this->mappedPointer = nullptr;
+			}
+
+			if (this->fileDescriptor >= 0)
+			{
+				::close(this->fileDescriptor);
+				this->fileDescriptor = -1;
+			}
+
+			this->composedBufferPointer = nullptr;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="message"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		[[noreturn]] inline void failMapping(const std::string& message)
+		{
+			int errorNumber = errno;
+
+			this->closeMapping();
+
+			throw SafeContextException(message + " `" + this->filePath + "`: " + std::strerror(errorNumber));
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		inline void mapBuffer()
+		{
+			struct stat fileStatus;
+			bool freshness = false;
+
+			this->mappedSize = SafeMappedMemoryChunk::headerSize + (SafeMappedMemoryChunk::elementStride * this->cardinality);
+			this->fileDescriptor = ::open((this->filePath).c_str(),O_RDWR | O_CREAT,0644);
+
+			if (this->fileDescriptor < 0)
+			{
+				this->failMapping("Unable to open");
+			}
+
+			if (::fstat(this->fileDescriptor,&fileStatus) != 0)
+			{
+				this->failMapping("Unable to query");
+			}
+
+			if (fileStatus.st_size == 0)
+			{
+				freshness = true;
+
+				if (::ftruncate(this->fileDescriptor,static_cast<off_t>(this->mappedSize)) != 0)
+				{
+					this->failMapping("Unable to size");
+				}
+			}
+			else if (static_cast<std::size_t>(fileStatus.st_size) != this->mappedSize)
+			{
+				errno = EINVAL;
+				this->failMapping("Unexpected size of");
+			}
+
+			void* mappedPointer = ::mmap(nullptr,this->mappedSize,PROT_READ | PROT_WRITE,MAP_SHARED,this->fileDescriptor,0);
+
+			if (mappedPointer == MAP_FAILED)
+			{
+				this->failMapping("Unable to map");
+			}
+
+			this->mappedPointer = static_cast<unsigned char*>(mappedPointer);
+			this->composedBufferPointer = reinterpret_cast<GenericTypeOfSafeContextDerivative*>(this->mappedPointer + SafeMappedMemoryChunk::headerSize);
+
+			SafeMappedHeader expectedHeader = SafeMappedHeader{{'S','A','F','E','M','A','P','S'},2,SafeMappedMemoryChunk::elementStride,this->cardinality,sizeof(GenericTypeOfSafeContextDerivative),SafeMappedMemoryChunk::elementAlignment,SafeLayoutVersion<GenericTypeOfSafeContextDerivative>::value};
+
+			if ((freshness == false) && (std::memcmp(this->mappedPointer,&expectedHeader,sizeof(SafeMappedHeader)) != 0))
+			{
+				errno = EINVAL;
+				this->failMapping("Incompatible header in");
+			}
+
+			try
+			{
+				std::vector<SafeContextBase*> chunkBufferElementPointers = std::vector<SafeContextBase*>();
+				std::size_t i = 0;
+
+				for (i = 0;i < this->cardinality;i++)
+				{
+					GenericTypeOfSafeContextDerivative* elementPointer = this->referToElementPointer(i);
+
+					(this->constantPointerMasks).push_back(static_cast<const void*>(elementPointer));
+					(this->variablePointerMasks).push_back(static_cast<void*>(elementPointer));
+					chunkBufferElementPointers.push_back(static_cast<SafeContextBase*>(elementPointer));
+				}
+
+				if (freshness == true)
+				{
+					SafeContextBase::helpInitializeChunk(chunkBufferElementPointers,this->cardinality,this->constantPointerMasks,this->variablePointerMasks,[](SafeContextBase* const instancePointer) -> void
+					{
+						::new(instancePointer) GenericTypeOfSafeContextDerivative();
+					});
+					std::memcpy(this->mappedPointer,&expectedHeader,sizeof(SafeMappedHeader));
+				}
+				else
+				{
+					SafeContextBase::helpInitializeChunk(chunkBufferElementPointers,this->cardinality,this->constantPointerMasks,this->variablePointerMasks,&SafeImagePrototype<GenericTypeOfSafeContextDerivative>::constructBase);
+				}
+			}
+			catch (...)
+			{
+				if ((freshness == true) && (this->fileDescriptor >= 0))
+				{
+					static_cast<void>(::ftruncate(this->fileDescriptor,0));
+				}
+
+				this->closeMapping();
+
+				throw;
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		inline void detachMapping() noexcept
+		{
+			if (this->mappedPointer == nullptr)
+			{
+				return;
+			}
+
+			::msync(this->mappedPointer,this->mappedSize,MS_SYNC);
+			static_cast<void>(::mmap(static_cast<void*>(this->mappedPointer),this->mappedSize,PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_FIXED,this->fileDescriptor,0));
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeMappedMemoryChunk`.
+		/// </summary>
+		/// <param name="filePath"></param>
+		/// <param name="cardinality"></param>
+		/// <exception cref="SafeContextException"/>
+		inline explicit SafeMappedMemoryChunk(const std::string& filePath,const std::size_t& cardinality) : SafeContextBase()
+		{
+			this->mappedPointer = nullptr;
+			this->mappedSize = 0;
+			this->fileDescriptor = -1;
+			this->filePath = filePath;
+			this->composedBufferPointer = nullptr;
+			this->cardinality = cardinality;
+			this->constantPointerMasks = std::vector<const void*>();
+			this->variablePointerMasks = std::vector<void*>();
+			this->mapBuffer();
+		};
+
+	private:
+		/// <summary>
+		///		Copy constructor of `SafeMappedMemoryChunk`.
+		/// </summary>
+		inline SafeMappedMemoryChunk(const SafeMappedMemoryChunk&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeMappedMemoryChunk`.
+		/// </summary>
+		inline SafeMappedMemoryChunk(SafeMappedMemoryChunk&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeMappedMemoryChunk`.
+		/// </summary>
+		inline virtual ~SafeMappedMemoryChunk() noexcept(false) override
+		{
+			this->detachMapping();
+
+			if (this->composedBufferPointer != nullptr)
+			{
+				std::size_t i = 0;
+				std::vector<SafeContextBase*> chunkBufferElementPointers = std::vector<SafeContextBase*>();
+
+				for (i = 0;i < this->cardinality;i++)
+				{
+					chunkBufferElementPointers.push_back(static_cast<SafeContextBase*>(this->referToElementPointer(i)));
+				}
+
+				SafeContextBase::destroyDerivedChunkOnMemoryHeap(chunkBufferElementPointers,this->cardinality,this->constantPointerMasks,this->variablePointerMasks);
+			}
+
+			this->closeMapping();
+		};
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeMappedMemoryChunk&amp;</returns>
+		inline SafeMappedMemoryChunk& operator=(const SafeMappedMemoryChunk&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeMappedMemoryChunk&amp;</returns>
+		inline SafeMappedMemoryChunk& operator=(SafeMappedMemoryChunk&&) = delete;
+
+	public:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator[]
+		/// </summary>
+		/// <param name="index"></param>
+		/// <returns>GenericTypeOfSafeContextDerivative&amp;</returns>
+		/// <exception cref="SafeContextException"/>
+		inline const GenericTypeOfSafeContextDerivative& operator[](const std::size_t& index) const
+		{
+			if (index >= this->cardinality)
+			{
+				throw SafeContextException("Argument `index` is out of bound: `" + std::to_string(index) + "` while the cardinality is `" + std::to_string(this->cardinality) + "`!");
+			}
+			else
+			{
+				return *(static_cast<const GenericTypeOfSafeContextDerivative*>((this->constantPointerMasks)[index]));
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator[]
+		/// </summary>
+		/// <param name="index"></param>
+		/// <returns>GenericTypeOfSafeContextDerivative&amp;</returns>
+		/// <exception cref="SafeContextException"/>
+		inline GenericTypeOfSafeContextDerivative& operator[](const std::size_t& index)
+		{
+			if (index >= this->cardinality)
+			{
+				throw SafeContextException("Argument `index` is out of bound: `" + std::to_string(index) + "` while the cardinality is `" + std::to_string(this->cardinality) + "`!");
+			}
+			else
+			{
+				return *(static_cast<GenericTypeOfSafeContextDerivative*>((this->variablePointerMasks)[index]));
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getCardinality() const noexcept
+		{
+			return this->cardinality;
+		};
+
+		/// <summary>
+		///		dynamic
+		/// </summary>
+		/// <returns>string</returns>
+		std::string getFilePath() const
+		{
+			return this->filePath;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		inline void flush()
+		{
+			this->flush(0,this->cardinality);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="index"></param>
+		/// <param name="count"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		inline void flush(const std::size_t& index,const std::size_t& count)
+		{
+			if ((index > this->cardinality) || (count > (this->cardinality - index)))
+			{
+				throw SafeContextException("Range `[" + std::to_string(index) + "," + std::to_string(index + count) + ")` is out of bound while the cardinality is `" + std::to_string(this->cardinality) + "`!");
+			}
+
+			if ((this->mappedPointer != nullptr) && (count > 0))
+			{
+				std::size_t pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+				std::size_t beginning = SafeMappedMemoryChunk::headerSize + (index * SafeMappedMemoryChunk::elementStride);
+				std::size_t ending = beginning + (count * SafeMappedMemoryChunk::elementStride);
+
+				beginning = (beginning / pageSize) * pageSize;
+
+				if (::msync(this->mappedPointer + beginning,ending - beginning,MS_SYNC) != 0)
+				{
+					throw SafeContextException("Unable to flush `" + this->filePath + "`: " + std::strerror(errno));
+				}
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="snapshotPath"></param>
+		/// <returns>void</returns>
+		/// <exception cref="SafeContextException"/>
+		inline void snapshot(const std::string& snapshotPath)
+		{
+			if (this->mappedPointer == nullptr)
+			{
+				throw SafeContextException("The current instance of `SafeMappedMemoryChunk` has been disposed!");
+			}
+
+			this->flush();
+
+			int snapshotDescriptor = ::open(snapshotPath.c_str(),O_WRONLY | O_CREAT | O_TRUNC,0644);
+			std::size_t writtenSize = 0;
+
+			if (snapshotDescriptor < 0)
+			{
+				throw SafeContextException("Unable to open `" + snapshotPath + "`: " + std::strerror(errno));
+			}
+
+			while (writtenSize < this->mappedSize)
+			{
+				ssize_t writingResult = ::write(snapshotDescriptor,this->mappedPointer + writtenSize,this->mappedSize - writtenSize);
+
+				if (writingResult < 0)
+				{
+					if (errno == EINTR)
+					{
+						continue;
+					}
+
+					int errorNumber = errno;
+					::close(snapshotDescriptor);
+
+					throw SafeContextException("Unable to write `" + snapshotPath + "`: " + std::strerror(errorNumber));
+				}
+
+				writtenSize += static_cast<std::size_t>(writingResult);
+			}
+
+			if ((::fsync(snapshotDescriptor) != 0) || (::close(snapshotDescriptor) != 0))
+			{
+				throw SafeContextException("Unable to persist `" + snapshotPath + "`: " + std::strerror(errno));
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>void</returns>
+		inline void dispose()
+		{
+			const SafeProxyInstancePair<GenericTypeOfSafeContextDerivative>& proxyInstancePair = SafeContextBase::referToProxyInstancesOfDerivedType<GenericTypeOfSafeContextDerivative>();
+			std::size_t i = 0;
+			std::vector<SafeContextBase*> chunkBufferElementPointers = std::vector<SafeContextBase*>();
+
+			chunkBufferElementPointers.reserve(this->cardinality);
+
+			for (i = 0;i < this->cardinality;i++)
+			{
+				chunkBufferElementPointers.push_back(static_cast<SafeContextBase*>(this->referToElementPointer(i)));
+			}
+
+			this->detachMapping();
+			SafeContextBase::helpDisposeChunk(chunkBufferElementPointers,this->cardinality,this->constantPointerMasks,this->variablePointerMasks,proxyInstancePair.constantProxyInstancePointer,proxyInstancePair.variableProxyInstancePointer);
+			this->closeMapping();
+		};
+	};
+
+	/// <summary>
+	///		C++ type name alias: `SafeMappedMemoryChunk`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> using SafeMappedMemoryChunk = SafeContextBase::SafeMappedMemoryChunk<GenericTypeOfSafeContextDerivative>;
+};
+
+#endif
\ No newline at end of file
@@ -20,14 +20,21 @@
 #pragma once
 
 /** Inclusion(s) of C++ standard library header file(s).**/
+#include <cstdint>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
 #include <vector>
 
 /** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeAlignment.h"
 #include "SafeContextBase.h"
 #include "SafeContextException.h"
+#include "SafeContextStatistics.h"
+#include "SafeImagePrototype.h"
+#include "SafeTrace.h"
+#include "SafeTraits.h"
 
 
 /** Main code.**/
@@ -59,30 +66,92 @@ namespace Safe
 		static_assert((std::is_pointer<GenericTypeOfSafeContextDerivative>::value == false),"`GenericTypeOfSafeContextDerivative` can't be a pointer type!");
 
 
+		static constexpr std::size_t elementAlignment = SafeAlignedLayout<GenericTypeOfSafeContextDerivative>::alignment;
+		static constexpr std::size_t elementStride = SafeAlignedLayout<GenericTypeOfSafeContextDerivative>::stride;
+
+	private:
 		/// <summary>
-		///		Constructor of `SafeMemoryChunk`.
+		///		dynamic
+		///		inline
+		///		noexcept
 		/// </summary>
-		inline constexpr explicit SafeMemoryChunk() : SafeContextBase()
+		/// <param name="index"></param>
+		/// <returns>GenericTypeOfSafeContextDerivative*</returns>
+		inline GenericTypeOfSafeContextDerivative* referToElementPointer(const std::size_t& index) const noexcept
 		{
-			this->cardinality = 10;
+			return reinterpret_cast<GenericTypeOfSafeContextDerivative*>(reinterpret_cast<unsigned char*>(this->composedBufferPointer) + (index * SafeMemoryChunk::elementStride));
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>void</returns>
+		inline void composeBuffer()
+		{
+			if constexpr (SafeImageConstructible<GenericTypeOfSafeContextDerivative>::value == true)
+			{
+				SafeImagePrototype<GenericTypeOfSafeContextDerivative>::referToPrototype();
+			}
+
 			this->constantPointerMasks = std::vector<const void*>();
 			this->variablePointerMasks = std::vector<void*>();
 			std::vector<SafeContextBase*> chunkBufferElementPointers = std::vector<SafeContextBase*>();
-			GenericTypeOfSafeContextDerivative* chunkPointer = static_cast<GenericTypeOfSafeContextDerivative*>(::operator new(sizeof(GenericTypeOfSafeContextDerivative) * this->cardinality));
+			this->composedBufferPointer = static_cast<GenericTypeOfSafeContextDerivative*>(::operator new(SafeMemoryChunk::elementStride * this->cardinality,std::align_val_t(SafeMemoryChunk::elementAlignment)));
 			std::size_t i = 0;
 
 			for (i = 0;i < this->cardinality;i++)
 			{
-				(this->constantPointerMasks).push_back(static_cast<const void*>(chunkPointer + i));
-				(this->variablePointerMasks).push_back(static_cast<void*>(chunkPointer + i));
-				chunkBufferElementPointers.push_back(static_cast<SafeContextBase*>(chunkPointer + i));
+				GenericTypeOfSafeContextDerivative* elementPointer = this->referToElementPointer(i);
+
+				(this->constantPointerMasks).push_back(static_cast<const void*>(elementPointer));
+				(this->variablePointerMasks).push_back(static_cast<void*>(elementPointer));
+				chunkBufferElementPointers.push_back(static_cast<SafeContextBase*>(elementPointer));
+			}
+
+			if constexpr (SafeImageConstructible<GenericTypeOfSafeContextDerivative>::value == true)
+			{
+				SafeImagePrototype<GenericTypeOfSafeContextDerivative>::referToPrototype().stampImage(static_cast<void*>(this->composedBufferPointer),SafeMemoryChunk::elementStride,this->cardinality);
+				SafeContextBase::helpInitializeChunk(chunkBufferElementPointers,this->cardinality,this->constantPointerMasks,this->variablePointerMasks,&SafeImagePrototype<GenericTypeOfSafeContextDerivative>::constructBase);
+			}
+			else
+			{
+				SafeContextBase::helpInitializeChunk(chunkBufferElementPointers,this->cardinality,this->constantPointerMasks,this->variablePointerMasks,[](SafeContextBase* const instancePointer) -> void
+				{
+					::new(instancePointer) GenericTypeOfSafeContextDerivative();
+				});
 			}
 
-			this->composedBufferPointer = chunkPointer;
-			SafeContextBase::helpInitializeChunk(chunkBufferElementPointers,this->cardinality,this->constantPointerMasks,this->variablePointerMasks,[](SafeContextBase* const instancePointer) -> void
+			SafeContextStatistics::referToTypeStatistics<GenericTypeOfSafeContextDerivative>().recordChunkComposition(SafeMemoryChunk::elementStride * this->cardinality);
+			CPP_SAFE_TRACE(chunk_compose,reinterpret_cast<std::uintptr_t>(static_cast<void*>(this->composedBufferPointer)),this->cardinality);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		inline void releaseBuffer() noexcept
+		{
+			if (this->composedBufferPointer == nullptr)
 			{
-				::new(instancePointer) GenericTypeOfSafeContextDerivative();
-			});
+				return;
+			}
+
+			SafeContextStatistics::referToTypeStatistics<GenericTypeOfSafeContextDerivative>().recordChunkRelease(SafeMemoryChunk::elementStride * this->cardinality);
+			::operator delete(static_cast<void*>(this->composedBufferPointer),std::align_val_t(SafeMemoryChunk::elementAlignment));
+			this->composedBufferPointer = nullptr;
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeMemoryChunk`.
+		/// </summary>
+		inline constexpr explicit SafeMemoryChunk() : SafeContextBase()
+		{
+			this->cardinality = 10;
+			this->composeBuffer();
 		};
 
 		/// <summary>
@@ -92,24 +161,7 @@ namespace Safe
 		inline explicit SafeMemoryChunk(const std::size_t& cardinality) : SafeContextBase()
 		{
 			this->cardinality = cardinality;
-			this->constantPointerMasks = std::vector<const void*>();
-			this->variablePointerMasks = std::vector<void*>();
-			std::vector<SafeContextBase*> chunkBufferElementPointers = std::vector<SafeContextBase*>();
-			GenericTypeOfSafeContextDerivative* chunkPointer = static_cast<GenericTypeOfSafeContextDerivative*>(::operator new(sizeof(GenericTypeOfSafeContextDerivative) * this->cardinality));
-			std::size_t i = 0;
-
-			for (i = 0;i < cardinality;i++)
-			{
-				(this->constantPointerMasks).push_back(static_cast<const void*>(chunkPointer + i));
-				(this->variablePointerMasks).push_back(static_cast<void*>(chunkPointer + i));
-				chunkBufferElementPointers.push_back(static_cast<SafeContextBase*>(chunkPointer + i));
-			}
-
-			this->composedBufferPointer = chunkPointer;
-			SafeContextBase::helpInitializeChunk(chunkBufferElementPointers,this->cardinality,this->constantPointerMasks,this->variablePointerMasks,[](SafeContextBase* const instancePointer) -> void
-			{
-				::new(instancePointer) GenericTypeOfSafeContextDerivative();
-			});
+			this->composeBuffer();
 		};
 
 	private:
@@ -136,12 +188,11 @@ namespace Safe
 
 				for (i = 0;i < this->cardinality;i++)
 				{
-					chunkBufferElementPointers.push_back(&((this->composedBufferPointer)[i]));
+					chunkBufferElementPointers.push_back(static_cast<SafeContextBase*>(this->referToElementPointer(i)));
 				}
 
 				SafeContextBase::destroyDerivedChunkOnMemoryHeap(chunkBufferElementPointers,this->cardinality,this->constantPointerMasks,this->variablePointerMasks);
-				::delete(static_cast<void*>(this->composedBufferPointer));
-				this->composedBufferPointer = nullptr;
+				this->releaseBuffer();
 			}
 		};
 
@@ -220,25 +271,20 @@ namespace Safe
 		/// <returns>void</returns>
 		inline void dispose()
 		{
-			const GenericTypeOfSafeContextDerivative* constantProxyInstancePointer = static_cast<const GenericTypeOfSafeContextDerivative*>(SafeContextBase::referToDefaultConstantInstance(typeid(GenericTypeOfSafeContextDerivative)));
-			GenericTypeOfSafeContextDerivative* variableProxyInstancePointer = ::new GenericTypeOfSafeContextDerivative();
-
-			if (constantProxyInstancePointer == nullptr)
-			{
-				constantProxyInstancePointer = SafeContextBase::supplementDefaultInstanceOfDerivedType<GenericTypeOfSafeContextDerivative>();
-			}
-
+			const SafeProxyInstancePair<GenericTypeOfSafeContextDerivative>& proxyInstancePair = SafeContextBase::referToProxyInstancesOfDerivedType<GenericTypeOfSafeContextDerivative>();
 			std::size_t i = 0;
 			std::vector<SafeContextBase*> chunkBufferElementPointers = std::vector<SafeContextBase*>();
 
+			chunkBufferElementPointers.reserve(this->cardinality);
+
 			for (i = 0;i < this->cardinality;i++)
 			{
-				chunkBufferElementPointers.push_back(&((this->composedBufferPointer)[i]));
+				chunkBufferElementPointers.push_back(static_cast<SafeContextBase*>(this->referToElementPointer(i)));
 			}
 
-			SafeContextBase::helpDisposeChunk(chunkBufferElementPointers,this->cardinality,this->constantPointerMasks,this->variablePointerMasks,constantProxyInstancePointer,variableProxyInstancePointer);
-			::delete static_cast<void*>(this->composedBufferPointer);
-			this->composedBufferPointer = nullptr;
+			CPP_SAFE_TRACE(chunk_dispose,reinterpret_cast<std::uintptr_t>(static_cast<void*>(this->composedBufferPointer)),this->cardinality);
+			SafeContextBase::helpDisposeChunk(chunkBufferElementPointers,this->cardinality,this->constantPointerMasks,this->variablePointerMasks,proxyInstancePair.constantProxyInstancePointer,proxyInstancePair.variableProxyInstancePointer);
+			this->releaseBuffer();
 		};
 	};
 
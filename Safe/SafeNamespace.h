@@ -50,6 +50,18 @@
 #define CPP_SAFE_LIBRARY_TRADE
 #endif
 
+#ifndef CPP_SAFE_INTERNAL_COROUTINE
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define CPP_SAFE_INTERNAL_COROUTINE 1
+#else
+#define CPP_SAFE_INTERNAL_COROUTINE 0
+#endif
+#else
+#define CPP_SAFE_INTERNAL_COROUTINE 0
+#endif
+#endif
+
 
 /// <summary>
 ///		C++ namespace: `Safe`.
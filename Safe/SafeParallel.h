@@ -0,0 +1,556 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeAlignment.h"
+#include "SafeContextException.h"
+#include "SafeLiveDirectory.h"
+#include "SafeTraits.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class: `SafeWorkStealingPool`.
+	/// </summary>
+	class SafeWorkStealingPool final
+	{
+	private:
+		static constexpr std::size_t cacheBlockSize = 32768;
+
+		/// <summary>
+		///		C++ structure: `SafeWorkRange`.
+		/// </summary>
+		struct alignas(SafeCacheLineAlignment::alignment) SafeWorkRange
+		{
+			std::mutex rangeMutex;
+			std::size_t beginBlock;
+			std::size_t endBlock;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeWorkJob`.
+		/// </summary>
+		struct SafeWorkJob
+		{
+			void (*blockInvoker)(void* const contextPointer,const std::size_t& beginIndex,const std::size_t& endIndex);
+			void* contextPointer;
+			std::size_t count;
+			std::size_t blockSize;
+			void (*participationMarker)(const bool& participating);
+		};
+
+		std::mutex passMutex;
+		std::mutex wakeMutex;
+		std::condition_variable wakeCondition;
+		std::condition_variable doneCondition;
+		std::uint64_t jobGeneration;
+		std::size_t activeWorkerCount;
+		bool stopping;
+		const SafeWorkJob* currentJobPointer;
+		std::mutex failureMutex;
+		std::exception_ptr failure;
+		std::atomic<bool> failed;
+		std::size_t participantCount;
+		std::unique_ptr<SafeWorkRange[]> ranges;
+		std::vector<std::thread> workerThreads;
+
+
+		/// <summary>
+		///		Constructor of `SafeWorkStealingPool`.
+		/// </summary>
+		inline explicit SafeWorkStealingPool() : passMutex(),wakeMutex(),wakeCondition(),doneCondition(),jobGeneration(0),activeWorkerCount(0),stopping(false),currentJobPointer(nullptr),failureMutex(),failure(),failed(false),participantCount(1),ranges(),workerThreads()
+		{
+			std::size_t workerCount = ((std::thread::hardware_concurrency() > 1) ? (std::thread::hardware_concurrency() - 1) : 0);
+			const char* workerCountValue = std::getenv("CPP_SAFE_PARALLEL_WORKERS");
+			std::size_t i = 0;
+
+			if ((workerCountValue != nullptr) && (*workerCountValue != '\0'))
+			{
+				workerCount = static_cast<std::size_t>(std::strtoull(workerCountValue,nullptr,10));
+			}
+
+			this->participantCount = workerCount + 1;
+			this->ranges.reset(::new SafeWorkRange[this->participantCount]);
+
+			try
+			{
+				(this->workerThreads).reserve(workerCount);
+
+				for (i = 0;i < workerCount;i++)
+				{
+					(this->workerThreads).emplace_back([this,i]() -> void
+					{
+						this->serve(i + 1);
+					});
+				}
+			}
+			catch (...)
+			{
+				this->stop();
+
+				throw;
+			}
+		};
+
+		/// <summary>
+		///		Copy constructor of `SafeWorkStealingPool`.
+		/// </summary>
+		inline SafeWorkStealingPool(const SafeWorkStealingPool&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeWorkStealingPool`.
+		/// </summary>
+		inline SafeWorkStealingPool(SafeWorkStealingPool&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeWorkStealingPool`.
+		/// </summary>
+		inline ~SafeWorkStealingPool()
+		{
+			this->stop();
+		};
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <returns>void</returns>
+		inline void stop()
+		{
+			{
+				std::lock_guard<std::mutex> wakeLock(this->wakeMutex);
+
+				this->stopping = true;
+			}
+
+			(this->wakeCondition).notify_all();
+
+			for (std::thread& workerThread : this->workerThreads)
+			{
+				if (workerThread.joinable() == true)
+				{
+					workerThread.join();
+				}
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeWorkStealingPool&amp;</returns>
+		inline SafeWorkStealingPool& operator=(const SafeWorkStealingPool&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeWorkStealingPool&amp;</returns>
+		inline SafeWorkStealingPool& operator=(SafeWorkStealingPool&&) = delete;
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>bool&amp;</returns>
+		static inline bool& referToParticipatingFlag() noexcept
+		{
+			static thread_local bool participating = false;
+
+			return participating;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="participantIndex"></param>
+		/// <returns>void</returns>
+		inline void serve(const std::size_t& participantIndex)
+		{
+			std::unique_lock<std::mutex> wakeLock(this->wakeMutex);
+			std::uint64_t servedGeneration = 0;
+
+			while (true)
+			{
+				(this->wakeCondition).wait(wakeLock,[this,&servedGeneration]() -> bool
+				{
+					return ((this->stopping == true) || (this->jobGeneration != servedGeneration));
+				});
+
+				if (this->stopping == true)
+				{
+					return;
+				}
+
+				servedGeneration = this->jobGeneration;
+
+				const SafeWorkJob* jobPointer = this->currentJobPointer;
+
+				wakeLock.unlock();
+				this->participate(*jobPointer,participantIndex);
+				wakeLock.lock();
+
+				if (--(this->activeWorkerCount) == 0)
+				{
+					(this->doneCondition).notify_one();
+				}
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="participantIndex"></param>
+		/// <param name="blockIndex"></param>
+		/// <returns>bool</returns>
+		inline bool takeBlock(const std::size_t& participantIndex,std::size_t& blockIndex) noexcept
+		{
+			SafeWorkRange& ownRange = (this->ranges)[participantIndex];
+			std::size_t i = 0;
+
+			{
+				std::lock_guard<std::mutex> rangeLock(ownRange.rangeMutex);
+
+				if (ownRange.beginBlock < ownRange.endBlock)
+				{
+					blockIndex = (ownRange.beginBlock)++;
+
+					return true;
+				}
+			}
+
+			for (i = 1;i < this->participantCount;i++)
+			{
+				SafeWorkRange& victimRange = (this->ranges)[(participantIndex + i) % this->participantCount];
+				std::size_t stolenBeginBlock = 0;
+				std::size_t stolenEndBlock = 0;
+
+				{
+					std::lock_guard<std::mutex> rangeLock(victimRange.rangeMutex);
+
+					if (victimRange.beginBlock >= victimRange.endBlock)
+					{
+						continue;
+					}
+
+					stolenEndBlock = victimRange.endBlock;
+					stolenBeginBlock = stolenEndBlock - ((victimRange.endBlock - victimRange.beginBlock + 1) / 2);
+					victimRange.endBlock = stolenBeginBlock;
+				}
+
+				std::lock_guard<std::mutex> rangeLock(ownRange.rangeMutex);
+
+				blockIndex = stolenBeginBlock;
+				ownRange.beginBlock = stolenBeginBlock + 1;
+				ownRange.endBlock = stolenEndBlock;
+
+				return true;
+			}
+
+			return false;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="job"></param>
+		/// <param name="participantIndex"></param>
+		/// <returns>void</returns>
+		inline void participate(const SafeWorkJob& job,const std::size_t& participantIndex) noexcept
+		{
+			std::size_t blockIndex = 0;
+			bool previousParticipating = SafeWorkStealingPool::referToParticipatingFlag();
+
+			SafeWorkStealingPool::referToParticipatingFlag() = true;
+			job.participationMarker(true);
+
+			while ((this->failed.load(std::memory_order_relaxed) == false) && (this->takeBlock(participantIndex,blockIndex) == true))
+			{
+				std::size_t beginIndex = blockIndex * job.blockSize;
+				std::size_t endIndex = (((job.count - beginIndex) < job.blockSize) ? job.count : (beginIndex + job.blockSize));
+
+				try
+				{
+					job.blockInvoker(job.contextPointer,beginIndex,endIndex);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> failureLock(this->failureMutex);
+
+					if (this->failed.exchange(true,std::memory_order_relaxed) == false)
+					{
+						this->failure = std::current_exception();
+					}
+				}
+			}
+
+			job.participationMarker(false);
+			SafeWorkStealingPool::referToParticipatingFlag() = previousParticipating;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="job"></param>
+		/// <returns>void</returns>
+		inline void run(const SafeWorkJob& job)
+		{
+			std::size_t blockCount = ((job.count + job.blockSize - 1) / job.blockSize);
+			std::size_t i = 0;
+
+			if ((this->participantCount == 1) || (blockCount <= 1) || (SafeWorkStealingPool::referToParticipatingFlag() == true))
+			{
+				job.blockInvoker(job.contextPointer,0,job.count);
+
+				return;
+			}
+
+			std::lock_guard<std::mutex> passLock(this->passMutex);
+
+			for (i = 0;i < this->participantCount;i++)
+			{
+				std::lock_guard<std::mutex> rangeLock(((this->ranges)[i]).rangeMutex);
+
+				((this->ranges)[i]).beginBlock = (blockCount * i) / this->participantCount;
+				((this->ranges)[i]).endBlock = (blockCount * (i + 1)) / this->participantCount;
+			}
+
+			this->failure = nullptr;
+			this->failed.store(false,std::memory_order_relaxed);
+
+			{
+				std::lock_guard<std::mutex> wakeLock(this->wakeMutex);
+
+				this->currentJobPointer = std::addressof(job);
+				this->activeWorkerCount = (this->workerThreads).size();
+				(this->jobGeneration)++;
+			}
+
+			(this->wakeCondition).notify_all();
+			this->participate(job,0);
+
+			{
+				std::unique_lock<std::mutex> wakeLock(this->wakeMutex);
+
+				(this->doneCondition).wait(wakeLock,[this]() -> bool
+				{
+					return (this->activeWorkerCount == 0);
+				});
+
+				this->currentJobPointer = nullptr;
+			}
+
+			if (this->failure != nullptr)
+			{
+				std::exception_ptr failure = this->failure;
+
+				this->failure = nullptr;
+				std::rethrow_exception(failure);
+			}
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="participating"></param>
+		/// <returns>void</returns>
+		static inline void markNothing(const bool& participating) noexcept
+		{
+			static_cast<void>(participating);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		/// <param name="participating"></param>
+		/// <returns>void</returns>
+		template<typename GenericTypeOfSafeContextDerivative> static inline void markLiveEnumeration(const bool& participating) noexcept
+		{
+			SafeLiveDirectory<GenericTypeOfSafeContextDerivative>::markEnumerating(participating);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>SafeWorkStealingPool&amp;</returns>
+		static inline SafeWorkStealingPool& referToPool()
+		{
+			static SafeWorkStealingPool pool;
+
+			return pool;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="elementSize"></param>
+		/// <returns>size_t</returns>
+		static inline std::size_t getBlockSize(const std::size_t& elementSize) noexcept
+		{
+			return ((elementSize >= SafeWorkStealingPool::cacheBlockSize) ? 1 : (SafeWorkStealingPool::cacheBlockSize / elementSize));
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfElement"></typeparam>
+		/// <typeparam name="GenericTypeOfIndexFunction"></typeparam>
+		/// <param name="count"></param>
+		/// <param name="indexFunction"></param>
+		/// <returns>void</returns>
+		template<typename GenericTypeOfElement,typename GenericTypeOfIndexFunction> inline void forEachIndex(const std::size_t& count,GenericTypeOfIndexFunction& indexFunction)
+		{
+			this->forEachIndex<GenericTypeOfElement>(count,indexFunction,&SafeWorkStealingPool::markNothing);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfElement"></typeparam>
+		/// <typeparam name="GenericTypeOfIndexFunction"></typeparam>
+		/// <param name="count"></param>
+		/// <param name="indexFunction"></param>
+		/// <param name="participationMarker"></param>
+		/// <returns>void</returns>
+		template<typename GenericTypeOfElement,typename GenericTypeOfIndexFunction> inline void forEachIndex(const std::size_t& count,GenericTypeOfIndexFunction& indexFunction,void (*participationMarker)(const bool& participating))
+		{
+			SafeWorkJob job = SafeWorkJob{[](void* const contextPointer,const std::size_t& beginIndex,const std::size_t& endIndex) -> void
+			{
+				GenericTypeOfIndexFunction& indexFunction = *static_cast<GenericTypeOfIndexFunction*>(contextPointer);
+				std::size_t i = 0;
+
+				for (i = beginIndex;i < endIndex;i++)
+				{
+					indexFunction(i);
+				}
+			},static_cast<void*>(std::addressof(indexFunction)),count,SafeWorkStealingPool::getBlockSize(sizeof(GenericTypeOfElement)),participationMarker};
+
+			if (count == 0)
+			{
+				return;
+			}
+
+			this->run(job);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getParticipantCount() const noexcept
+		{
+			return this->participantCount;
+		};
+	};
+
+	/// <summary>
+	///		static
+	///		inline
+	/// </summary>
+	/// <typeparam name="GenericTypeOfChunk"></typeparam>
+	/// <typeparam name="GenericTypeOfFunction"></typeparam>
+	/// <param name="chunk"></param>
+	/// <param name="function"></param>
+	/// <returns>void</returns>
+	/// <exception cref="SafeContextException"/>
+	template<typename GenericTypeOfChunk,typename GenericTypeOfFunction> inline void parallelForEach(GenericTypeOfChunk& chunk,GenericTypeOfFunction&& function)
+	{
+		using GenericTypeOfElement = typename std::remove_reference<decltype(chunk[0])>::type;
+
+		auto indexFunction = [&chunk,&function](const std::size_t& index) -> void
+		{
+			function(chunk[index]);
+		};
+
+		SafeWorkStealingPool::referToPool().forEachIndex<GenericTypeOfElement>(chunk.getCardinality(),indexFunction);
+	};
+
+	/// <summary>
+	///		static
+	///		inline
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	/// <typeparam name="GenericTypeOfFunction"></typeparam>
+	/// <param name="function"></param>
+	/// <returns>void</returns>
+	/// <exception cref="SafeContextException"/>
+	template<typename GenericTypeOfSafeContextDerivative,typename GenericTypeOfFunction> inline void parallelForEachLive(GenericTypeOfFunction&& function)
+	{
+		static_assert((SafeLiveEnumerable<GenericTypeOfSafeContextDerivative>::value == true),"`GenericTypeOfSafeContextDerivative` must specialize `SafeLiveEnumerable` as `std::true_type`!");
+
+		SafeLiveDirectory<GenericTypeOfSafeContextDerivative>::referToDirectory().enumerate([&function](const typename SafeLiveDirectory<GenericTypeOfSafeContextDerivative>::SafeLiveSlot* const instanceSlots,const std::size_t& count) -> void
+		{
+			auto indexFunction = [instanceSlots,&function](const std::size_t& index) -> void
+			{
+				GenericTypeOfSafeContextDerivative* const instancePointer = ((instanceSlots[index]).instancePointer).load(std::memory_order_acquire);
+
+				if (instancePointer != nullptr)
+				{
+					function(*instancePointer);
+				}
+			};
+
+			SafeWorkStealingPool::referToPool().forEachIndex<GenericTypeOfSafeContextDerivative>(count,indexFunction,&SafeWorkStealingPool::markLiveEnumeration<GenericTypeOfSafeContextDerivative>);
+		});
+	};
+};
\ No newline at end of file
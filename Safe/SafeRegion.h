@@ -0,0 +1,530 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextBase.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class: `SafeRegion`.
+	/// </summary>
+	class SafeRegion final
+	{
+	private:
+		static constexpr std::size_t initialBlockSize = 65536;
+		static constexpr std::uintptr_t regionTag = 1;
+
+		/// <summary>
+		///		C++ structure: `SafeRegionBlock`.
+		/// </summary>
+		struct SafeRegionBlock
+		{
+			SafeRegionBlock* nextBlockPointer;
+			std::size_t blockSize;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeRegionFinalizer`.
+		/// </summary>
+		struct SafeRegionFinalizer
+		{
+			void (*finalizeFunctionPointer)(void* const);
+			SafeRegionFinalizer* nextFinalizerPointer;
+		};
+
+		SafeRegion* previousRegionPointer;
+		SafeRegionBlock* headBlockPointer;
+		SafeRegionBlock* currentBlockPointer;
+		std::uintptr_t currentAddress;
+		std::uintptr_t limitAddress;
+		SafeRegionFinalizer* headFinalizerPointer;
+		std::uintptr_t epochTag;
+		std::size_t allocatedSize;
+		std::size_t allocatedCount;
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>SafeRegion*&amp;</returns>
+		static inline SafeRegion*& referToActiveRegionPointer() noexcept
+		{
+			static thread_local SafeRegion* activeRegionPointer = nullptr;
+
+			return activeRegionPointer;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>atomic&lt;size_t&gt;&amp;</returns>
+		static inline std::atomic<std::size_t>& referToRejectedReleaseCount() noexcept
+		{
+			static std::atomic<std::size_t> rejectedReleaseCount(0);
+
+			return rejectedReleaseCount;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>uintptr_t</returns>
+		static inline std::uintptr_t issueEpochTag() noexcept
+		{
+			static std::atomic<std::uintptr_t> epochCount(0);
+
+			return ((epochCount.fetch_add(1,std::memory_order_relaxed) + 1) << 1) | SafeRegion::regionTag;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="memoryPointer"></param>
+		/// <returns>uintptr_t&amp;</returns>
+		static inline std::uintptr_t& referToTag(void* const memoryPointer) noexcept
+		{
+			return *reinterpret_cast<std::uintptr_t*>(static_cast<unsigned char*>(memoryPointer) - sizeof(std::uintptr_t));
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="memoryPointer"></param>
+		/// <returns>SafeRegionFinalizer*</returns>
+		static inline SafeRegionFinalizer* referToFinalizer(void* const memoryPointer) noexcept
+		{
+			return reinterpret_cast<SafeRegionFinalizer*>(static_cast<unsigned char*>(memoryPointer) - sizeof(std::uintptr_t) - sizeof(SafeRegionFinalizer));
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <typeparam name="GenericType"></typeparam>
+		/// <param name="instancePointer"></param>
+		/// <returns>void</returns>
+		template<typename GenericType> static inline void finalize(void* const instancePointer) noexcept
+		{
+			static_cast<GenericType*>(instancePointer)->~GenericType();
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="blockPointer"></param>
+		/// <returns>uintptr_t</returns>
+		static inline std::uintptr_t locateBlockStart(SafeRegionBlock* const blockPointer) noexcept
+		{
+			return reinterpret_cast<std::uintptr_t>(blockPointer) + sizeof(SafeRegionBlock);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="blockPointer"></param>
+		/// <returns>uintptr_t</returns>
+		static inline std::uintptr_t locateBlockEnd(SafeRegionBlock* const blockPointer) noexcept
+		{
+			return reinterpret_cast<std::uintptr_t>(blockPointer) + blockPointer->blockSize;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="address"></param>
+		/// <param name="alignment"></param>
+		/// <returns>uintptr_t</returns>
+		static inline std::uintptr_t alignAddress(const std::uintptr_t& address,const std::size_t& alignment) noexcept
+		{
+			return ((address + (alignment - 1)) & ~(static_cast<std::uintptr_t>(alignment) - 1));
+		};
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeRegion`.
+		/// </summary>
+		inline explicit SafeRegion() noexcept : previousRegionPointer(SafeRegion::referToActiveRegionPointer()),headBlockPointer(nullptr),currentBlockPointer(nullptr),currentAddress(0),limitAddress(0),headFinalizerPointer(nullptr),epochTag(SafeRegion::issueEpochTag()),allocatedSize(0),allocatedCount(0)
+		{
+			SafeRegion::referToActiveRegionPointer() = this;
+		};
+
+	private:
+		/// <summary>
+		///		Copy constructor of `SafeRegion`.
+		/// </summary>
+		inline SafeRegion(const SafeRegion&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeRegion`.
+		/// </summary>
+		inline SafeRegion(SafeRegion&&) = delete;
+
+	public:
+		/// <summary>
+		///		Destructor of `SafeRegion`.
+		/// </summary>
+		inline ~SafeRegion() noexcept
+		{
+			this->reset();
+
+			while (this->headBlockPointer != nullptr)
+			{
+				SafeRegionBlock* nextBlockPointer = (this->headBlockPointer)->nextBlockPointer;
+
+				::operator delete(static_cast<void*>(this->headBlockPointer));
+				this->headBlockPointer = nextBlockPointer;
+			}
+
+			SafeRegion::referToActiveRegionPointer() = this->previousRegionPointer;
+		};
+
+	private:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeRegion&amp;</returns>
+		inline SafeRegion& operator=(const SafeRegion&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeRegion&amp;</returns>
+		inline SafeRegion& operator=(SafeRegion&&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="memorySize"></param>
+		/// <param name="alignment"></param>
+		/// <param name="finalizeFunctionPointer"></param>
+		/// <returns>void*</returns>
+		inline void* allocateWithFinalizer(const std::size_t& memorySize,const std::size_t& alignment,void (*finalizeFunctionPointer)(void* const))
+		{
+			std::size_t headerSize = sizeof(std::uintptr_t) + ((finalizeFunctionPointer != nullptr) ? sizeof(SafeRegionFinalizer) : 0);
+			std::size_t blockAlignment = ((alignment > alignof(SafeRegionFinalizer)) ? alignment : alignof(SafeRegionFinalizer));
+			std::uintptr_t instanceAddress = SafeRegion::alignAddress(this->currentAddress + headerSize,blockAlignment);
+
+			if ((this->currentBlockPointer == nullptr) || (instanceAddress + memorySize > this->limitAddress))
+			{
+				std::size_t requiredSize = sizeof(SafeRegionBlock) + headerSize + memorySize + blockAlignment;
+				SafeRegionBlock* nextBlockPointer = ((this->currentBlockPointer != nullptr) ? (this->currentBlockPointer)->nextBlockPointer : this->headBlockPointer);
+
+				while ((nextBlockPointer != nullptr) && (nextBlockPointer->blockSize < requiredSize))
+				{
+					nextBlockPointer = nextBlockPointer->nextBlockPointer;
+				}
+
+				if (nextBlockPointer == nullptr)
+				{
+					std::size_t blockSize = ((this->currentBlockPointer != nullptr) ? ((this->currentBlockPointer)->blockSize * 2) : SafeRegion::initialBlockSize);
+
+					while (blockSize < requiredSize)
+					{
+						blockSize *= 2;
+					}
+
+					nextBlockPointer = static_cast<SafeRegionBlock*>(::operator new(blockSize));
+					nextBlockPointer->blockSize = blockSize;
+
+					if (this->currentBlockPointer != nullptr)
+					{
+						nextBlockPointer->nextBlockPointer = (this->currentBlockPointer)->nextBlockPointer;
+						(this->currentBlockPointer)->nextBlockPointer = nextBlockPointer;
+					}
+					else
+					{
+						nextBlockPointer->nextBlockPointer = this->headBlockPointer;
+						this->headBlockPointer = nextBlockPointer;
+					}
+				}
+
+				this->currentBlockPointer = nextBlockPointer;
+				this->currentAddress = SafeRegion::locateBlockStart(nextBlockPointer);
+				this->limitAddress = SafeRegion::locateBlockEnd(nextBlockPointer);
+				instanceAddress = SafeRegion::alignAddress(this->currentAddress + headerSize,blockAlignment);
+			}
+
+			SafeRegion::referToTag(reinterpret_cast<void*>(instanceAddress)) = this->epochTag;
+
+			if (finalizeFunctionPointer != nullptr)
+			{
+				SafeRegionFinalizer* finalizerPointer = SafeRegion::referToFinalizer(reinterpret_cast<void*>(instanceAddress));
+
+				finalizerPointer->finalizeFunctionPointer = finalizeFunctionPointer;
+				finalizerPointer->nextFinalizerPointer = this->headFinalizerPointer;
+				this->headFinalizerPointer = finalizerPointer;
+			}
+
+			this->currentAddress = instanceAddress + memorySize;
+			this->allocatedSize += memorySize;
+			this->allocatedCount++;
+
+			return reinterpret_cast<void*>(instanceAddress);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="memoryPointer"></param>
+		/// <returns>bool</returns>
+		inline bool owns(const void* const memoryPointer) const noexcept
+		{
+			std::uintptr_t address = reinterpret_cast<std::uintptr_t>(memoryPointer);
+			SafeRegionBlock* blockPointer = this->headBlockPointer;
+
+			while (blockPointer != nullptr)
+			{
+				if ((address >= SafeRegion::locateBlockStart(blockPointer)) && (address < SafeRegion::locateBlockEnd(blockPointer)))
+				{
+					return true;
+				}
+
+				blockPointer = blockPointer->nextBlockPointer;
+			}
+
+			return false;
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>SafeRegion*</returns>
+		static inline SafeRegion* getActiveRegion() noexcept
+		{
+			return SafeRegion::referToActiveRegionPointer();
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericType"></typeparam>
+		/// <returns>void*</returns>
+		template<typename GenericType> static inline void* allocateInActiveRegion()
+		{
+			SafeRegion* activeRegionPointer = SafeRegion::referToActiveRegionPointer();
+
+			if (activeRegionPointer == nullptr)
+			{
+				return nullptr;
+			}
+
+			return activeRegionPointer->allocateWithFinalizer(sizeof(GenericType),alignof(GenericType),((std::is_trivially_destructible<GenericType>::value == true) ? nullptr : &SafeRegion::finalize<GenericType>));
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <typeparam name="GenericType"></typeparam>
+		/// <param name="memoryPointer"></param>
+		/// <returns>bool</returns>
+		template<typename GenericType> static inline bool releaseInActiveRegion(void* const memoryPointer) noexcept
+		{
+			SafeRegion* regionPointer = SafeRegion::referToActiveRegionPointer();
+
+			while (regionPointer != nullptr)
+			{
+				if (regionPointer->owns(memoryPointer) == true)
+				{
+					if (SafeRegion::referToTag(memoryPointer) != regionPointer->epochTag)
+					{
+						break;
+					}
+
+					if (std::is_trivially_destructible<GenericType>::value == false)
+					{
+						SafeRegion::referToFinalizer(memoryPointer)->finalizeFunctionPointer = nullptr;
+					}
+
+					return true;
+				}
+
+				regionPointer = regionPointer->previousRegionPointer;
+			}
+
+			SafeRegion::referToRejectedReleaseCount().fetch_add(1,std::memory_order_relaxed);
+			assert(false && "An instance of a region must be deleted on the thread of the region, before the region is reset or destroyed!");
+
+			return false;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="memoryPointer"></param>
+		/// <returns>bool</returns>
+		static inline bool isRegionMemory(void* const memoryPointer) noexcept
+		{
+			return ((SafeRegion::referToTag(memoryPointer) & SafeRegion::regionTag) == SafeRegion::regionTag);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline std::size_t getRejectedReleaseCount() noexcept
+		{
+			return SafeRegion::referToRejectedReleaseCount().load(std::memory_order_relaxed);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericType"></typeparam>
+		/// <typeparam name="GenericTypesOfArguments"></typeparam>
+		/// <param name="arguments"></param>
+		/// <returns>GenericType&amp;</returns>
+		template<typename GenericType,typename... GenericTypesOfArguments> inline GenericType& create(GenericTypesOfArguments&&... arguments)
+		{
+			static_assert((std::is_base_of<SafeContextBase,GenericType>::value == false),"`GenericType` can't be a tracked type inherited from `SafeContextBase`!");
+
+			void* memoryPointer = this->allocateWithFinalizer(sizeof(GenericType),alignof(GenericType),((std::is_trivially_destructible<GenericType>::value == true) ? nullptr : &SafeRegion::finalize<GenericType>));
+
+			try
+			{
+				return *(::new(memoryPointer) GenericType(static_cast<GenericTypesOfArguments&&>(arguments)...));
+			}
+			catch (...)
+			{
+				if (std::is_trivially_destructible<GenericType>::value == false)
+				{
+					(this->headFinalizerPointer)->finalizeFunctionPointer = nullptr;
+				}
+
+				throw;
+			}
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>void</returns>
+		inline void reset() noexcept
+		{
+			while (this->headFinalizerPointer != nullptr)
+			{
+				SafeRegionFinalizer* finalizerPointer = this->headFinalizerPointer;
+
+				this->headFinalizerPointer = finalizerPointer->nextFinalizerPointer;
+
+				if (finalizerPointer->finalizeFunctionPointer != nullptr)
+				{
+					(finalizerPointer->finalizeFunctionPointer)(reinterpret_cast<unsigned char*>(finalizerPointer) + sizeof(SafeRegionFinalizer) + sizeof(std::uintptr_t));
+				}
+			}
+
+			this->currentBlockPointer = this->headBlockPointer;
+			this->currentAddress = ((this->headBlockPointer != nullptr) ? SafeRegion::locateBlockStart(this->headBlockPointer) : 0);
+			this->limitAddress = ((this->headBlockPointer != nullptr) ? SafeRegion::locateBlockEnd(this->headBlockPointer) : 0);
+			this->epochTag = SafeRegion::issueEpochTag();
+			this->allocatedSize = 0;
+			this->allocatedCount = 0;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getAllocatedSize() const noexcept
+		{
+			return this->allocatedSize;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getAllocatedCount() const noexcept
+		{
+			return this->allocatedCount;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getReservedSize() const noexcept
+		{
+			SafeRegionBlock* blockPointer = this->headBlockPointer;
+			std::size_t reservedSize = 0;
+
+			while (blockPointer != nullptr)
+			{
+				reservedSize += blockPointer->blockSize;
+				blockPointer = blockPointer->nextBlockPointer;
+			}
+
+			return reservedSize;
+		};
+	};
+};
\ No newline at end of file
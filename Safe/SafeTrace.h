@@ -0,0 +1,458 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeNamespace.h"
+
+#ifdef UNIX
+#include <unistd.h>
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define CPP_SAFE_TRACE_PROBES
+#endif
+#endif
+#endif
+
+
+/** Main code.**/
+
+#ifndef CPP_SAFE_TRACE_BUFFER_CAPACITY
+#define CPP_SAFE_TRACE_BUFFER_CAPACITY 16384
+#endif
+
+#ifdef CPP_SAFE_TRACE_PROBES
+#define CPP_SAFE_TRACE_PROBE(name,firstArgument,secondArgument) DTRACE_PROBE2(cpp_safe,name,firstArgument,secondArgument)
+#else
+#define CPP_SAFE_TRACE_PROBE(name,firstArgument,secondArgument)
+#endif
+
+#ifdef CPP_SAFE_TRACE_BUFFER
+#define CPP_SAFE_TRACE(name,firstArgument,secondArgument) do { CPP_SAFE_TRACE_PROBE(name,firstArgument,secondArgument); ::Safe::SafeTrace::record(#name,'i',static_cast<std::uint64_t>(firstArgument),static_cast<std::uint64_t>(secondArgument)); } while (false)
+#else
+#define CPP_SAFE_TRACE(name,firstArgument,secondArgument) do { CPP_SAFE_TRACE_PROBE(name,firstArgument,secondArgument); } while (false)
+#endif
+
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class: `SafeTrace`.
+	/// </summary>
+	class SafeTrace final
+	{
+	private:
+		static constexpr std::size_t capacity = CPP_SAFE_TRACE_BUFFER_CAPACITY;
+
+		static_assert(((SafeTrace::capacity & (SafeTrace::capacity - 1)) == 0) && (SafeTrace::capacity > 0),"`CPP_SAFE_TRACE_BUFFER_CAPACITY` must be a power of two!");
+
+		/// <summary>
+		///		C++ structure: `SafeTraceRecord`.
+		/// </summary>
+		struct SafeTraceRecord
+		{
+			std::atomic<std::uint64_t> sequence;
+			std::atomic<std::uint64_t> timestamp;
+			std::atomic<const char*> name;
+			std::atomic<std::uint64_t> firstArgument;
+			std::atomic<std::uint64_t> secondArgument;
+			std::atomic<char> phase;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeTraceBuffer`.
+		/// </summary>
+		struct SafeTraceBuffer
+		{
+			std::atomic<std::uint64_t> position;
+			std::atomic<bool> occupancy;
+			std::size_t threadIndex;
+			SafeTraceRecord records[SafeTrace::capacity];
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeTraceBufferOwnership`.
+		/// </summary>
+		struct SafeTraceBufferOwnership
+		{
+			SafeTraceBuffer* bufferPointer;
+
+
+			/// <summary>
+			///		Destructor of `SafeTraceBufferOwnership`.
+			/// </summary>
+			inline ~SafeTraceBufferOwnership() noexcept
+			{
+				SafeTrace::referToReleaseFlag() = true;
+
+				if (this->bufferPointer != nullptr)
+				{
+					(this->bufferPointer)->occupancy.store(false,std::memory_order_release);
+				}
+			};
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeTraceRegistry`.
+		/// </summary>
+		struct SafeTraceRegistry
+		{
+			std::mutex registryMutex;
+			std::vector<std::unique_ptr<SafeTraceBuffer>> buffers;
+		};
+
+		/// <summary>
+		///		C++ structure: `SafeTraceEntry`.
+		/// </summary>
+		struct SafeTraceEntry
+		{
+			std::uint64_t timestamp;
+			const char* name;
+			std::uint64_t firstArgument;
+			std::uint64_t secondArgument;
+			char phase;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>SafeTraceRegistry&amp;</returns>
+		static inline SafeTraceRegistry& referToRegistry() noexcept
+		{
+			static SafeTraceRegistry* registryPointer = new SafeTraceRegistry();
+
+			return *registryPointer;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>bool&amp;</returns>
+		static inline bool& referToReleaseFlag() noexcept
+		{
+			static thread_local bool release = false;
+
+			return release;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>SafeTraceBuffer*</returns>
+		static inline SafeTraceBuffer* referToThreadBuffer() noexcept
+		{
+			if (SafeTrace::referToReleaseFlag() == true)
+			{
+				return nullptr;
+			}
+
+			static thread_local SafeTraceBufferOwnership ownership{nullptr};
+
+			if (ownership.bufferPointer == nullptr)
+			{
+				try
+				{
+					SafeTraceRegistry& registry = SafeTrace::referToRegistry();
+					std::lock_guard<std::mutex> registryLock(registry.registryMutex);
+					std::size_t i = 0;
+
+					for (i = 0;i < (registry.buffers).size();i++)
+					{
+						if (((registry.buffers)[i])->occupancy.load(std::memory_order_acquire) == false)
+						{
+							((registry.buffers)[i])->occupancy.store(true,std::memory_order_relaxed);
+							ownership.bufferPointer = (registry.buffers)[i].get();
+
+							return ownership.bufferPointer;
+						}
+					}
+
+					std::unique_ptr<SafeTraceBuffer> buffer = std::unique_ptr<SafeTraceBuffer>(new SafeTraceBuffer());
+
+					buffer->position.store(0,std::memory_order_relaxed);
+					buffer->occupancy.store(true,std::memory_order_relaxed);
+					buffer->threadIndex = (registry.buffers).size() + 1;
+					(registry.buffers).push_back(static_cast<std::unique_ptr<SafeTraceBuffer>&&>(buffer));
+					ownership.bufferPointer = (registry.buffers).back().get();
+				}
+				catch (...)
+				{
+					return nullptr;
+				}
+			}
+
+			return ownership.bufferPointer;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="outputStream"></param>
+		/// <param name="text"></param>
+		/// <returns>void</returns>
+		static inline void writeEscaped(std::ostream& outputStream,const char* const text)
+		{
+			const char* characterPointer = text;
+
+			while (*characterPointer != '\0')
+			{
+				if ((*characterPointer == '"') || (*characterPointer == '\\'))
+				{
+					outputStream << '\\';
+				}
+
+				if (static_cast<unsigned char>(*characterPointer) >= 0x20)
+				{
+					outputStream << *characterPointer;
+				}
+
+				characterPointer++;
+			}
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>uint64_t</returns>
+		static inline std::uint64_t getTimestamp() noexcept
+		{
+			return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="name"></param>
+		/// <param name="phase"></param>
+		/// <param name="firstArgument"></param>
+		/// <param name="secondArgument"></param>
+		/// <returns>void</returns>
+		static inline void record(const char* const name,const char& phase,const std::uint64_t& firstArgument,const std::uint64_t& secondArgument) noexcept
+		{
+			SafeTraceBuffer* bufferPointer = SafeTrace::referToThreadBuffer();
+
+			if (bufferPointer == nullptr)
+			{
+				return;
+			}
+
+			std::uint64_t position = bufferPointer->position.load(std::memory_order_relaxed);
+			SafeTraceRecord& recordReference = (bufferPointer->records)[position & (SafeTrace::capacity - 1)];
+
+			bufferPointer->position.store(position + 1,std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			recordReference.timestamp.store(SafeTrace::getTimestamp(),std::memory_order_relaxed);
+			recordReference.name.store(name,std::memory_order_relaxed);
+			recordReference.firstArgument.store(firstArgument,std::memory_order_relaxed);
+			recordReference.secondArgument.store(secondArgument,std::memory_order_relaxed);
+			recordReference.phase.store(phase,std::memory_order_relaxed);
+			recordReference.sequence.store(position + 1,std::memory_order_release);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="outputStream"></param>
+		/// <returns>void</returns>
+		static inline void write(std::ostream& outputStream)
+		{
+			SafeTraceRegistry& registry = SafeTrace::referToRegistry();
+			std::lock_guard<std::mutex> registryLock(registry.registryMutex);
+			std::vector<SafeTraceEntry> entries;
+			bool firstEntry = true;
+			std::size_t i = 0;
+			std::uint64_t processIdentifier = 0;
+
+#ifdef UNIX
+			processIdentifier = static_cast<std::uint64_t>(::getpid());
+#endif
+
+			outputStream << "{\"traceEvents\":[";
+
+			for (i = 0;i < (registry.buffers).size();i++)
+			{
+				SafeTraceBuffer& buffer = *((registry.buffers)[i]);
+				std::uint64_t endPosition = buffer.position.load(std::memory_order_acquire);
+				std::uint64_t beginPosition = ((endPosition > SafeTrace::capacity) ? (endPosition - SafeTrace::capacity) : 0);
+				std::uint64_t position = 0;
+				std::uint64_t overwrittenPosition = 0;
+				std::size_t j = 0;
+
+				entries.clear();
+
+				for (position = beginPosition;position < endPosition;position++)
+				{
+					SafeTraceRecord& recordReference = (buffer.records)[position & (SafeTrace::capacity - 1)];
+
+					if (recordReference.sequence.load(std::memory_order_acquire) != (position + 1))
+					{
+						entries.push_back(SafeTraceEntry{0,nullptr,0,0,'\0'});
+
+						continue;
+					}
+
+					entries.push_back(SafeTraceEntry{recordReference.timestamp.load(std::memory_order_relaxed),recordReference.name.load(std::memory_order_relaxed),recordReference.firstArgument.load(std::memory_order_relaxed),recordReference.secondArgument.load(std::memory_order_relaxed),recordReference.phase.load(std::memory_order_relaxed)});
+				}
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				overwrittenPosition = buffer.position.load(std::memory_order_relaxed);
+				overwrittenPosition = ((overwrittenPosition > SafeTrace::capacity) ? (overwrittenPosition - SafeTrace::capacity) : 0);
+
+				for (j = 0;j < entries.size();j++)
+				{
+					if (((beginPosition + j) < overwrittenPosition) || (entries[j].name == nullptr) || (entries[j].phase == '\0'))
+					{
+						continue;
+					}
+
+					if (firstEntry == false)
+					{
+						outputStream << ",";
+					}
+
+					firstEntry = false;
+					outputStream << "\n{\"name\":\"";
+					SafeTrace::writeEscaped(outputStream,entries[j].name);
+					outputStream << "\",\"cat\":\"safe\",\"ph\":\"" << entries[j].phase << "\"";
+
+					if (entries[j].phase == 'i')
+					{
+						outputStream << ",\"s\":\"t\"";
+					}
+
+					outputStream << ",\"ts\":" << (entries[j].timestamp / 1000) << "." << ((entries[j].timestamp % 1000) / 100) << ((entries[j].timestamp % 100) / 10) << (entries[j].timestamp % 10);
+					outputStream << ",\"pid\":" << processIdentifier << ",\"tid\":" << buffer.threadIndex;
+					outputStream << ",\"args\":{\"first\":" << entries[j].firstArgument << ",\"second\":" << entries[j].secondArgument << "}}";
+				}
+			}
+
+			outputStream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>string</returns>
+		static inline std::string format()
+		{
+			std::ostringstream outputStream;
+
+			SafeTrace::write(outputStream);
+
+			return outputStream.str();
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		static inline constexpr std::size_t getCapacity() noexcept
+		{
+			return SafeTrace::capacity;
+		};
+
+		/// <summary>
+		///		C++ class: `SafeTraceSpan`.
+		/// </summary>
+		class SafeTraceSpan final
+		{
+		private:
+			const char* name;
+
+			/// <summary>
+			///		Copy constructor of `SafeTraceSpan`.
+			/// </summary>
+			inline SafeTraceSpan(const SafeTraceSpan&) = delete;
+
+			/// <summary>
+			///		Move constructor of `SafeTraceSpan`.
+			/// </summary>
+			inline SafeTraceSpan(SafeTraceSpan&&) = delete;
+
+			/// <summary>
+			///		dynamic
+			///		inline
+			///		operator=
+			/// </summary>
+			/// <returns>SafeTraceSpan&amp;</returns>
+			inline SafeTraceSpan& operator=(const SafeTraceSpan&) = delete;
+
+			/// <summary>
+			///		dynamic
+			///		inline
+			///		operator=
+			/// </summary>
+			/// <returns>SafeTraceSpan&amp;</returns>
+			inline SafeTraceSpan& operator=(SafeTraceSpan&&) = delete;
+
+		public:
+			/// <summary>
+			///		Constructor of `SafeTraceSpan`.
+			/// </summary>
+			/// <param name="name"></param>
+			/// <param name="firstArgument"></param>
+			/// <param name="secondArgument"></param>
+			inline explicit SafeTraceSpan(const char* const name,const std::uint64_t& firstArgument = 0,const std::uint64_t& secondArgument = 0) noexcept : name(name)
+			{
+				SafeTrace::record(this->name,'B',firstArgument,secondArgument);
+			};
+
+			/// <summary>
+			///		Destructor of `SafeTraceSpan`.
+			/// </summary>
+			inline ~SafeTraceSpan() noexcept
+			{
+				SafeTrace::record(this->name,'E',0,0);
+			};
+		};
+	};
+};
\ No newline at end of file
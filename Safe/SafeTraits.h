@@ -0,0 +1,100 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ structure template: `SafeTriviallyRelocatable`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> struct SafeTriviallyRelocatable : std::false_type
+	{
+
+	};
+
+	/// <summary>
+	///		C++ structure template: `SafeLayoutVersion`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> struct SafeLayoutVersion : std::integral_constant<std::uint64_t,0>
+	{
+
+	};
+
+	/// <summary>
+	///		C++ structure template: `SafeImageConstructible`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> struct SafeImageConstructible : std::false_type
+	{
+
+	};
+
+	/// <summary>
+	///		C++ structure template: `SafeLiveEnumerable`.
+	/// </summary>
+	/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+	template<typename GenericTypeOfSafeContextDerivative> struct SafeLiveEnumerable : std::false_type
+	{
+
+	};
+
+	/// <summary>
+	///		C++ structure template: `SafeRelocationHook`.
+	/// </summary>
+	/// <typeparam name="GenericType"></typeparam>
+	template<typename GenericType> struct SafeRelocationHook : std::false_type
+	{
+
+	};
+
+	/// <summary>
+	///		C++ structure template: `SafeDefaultRelocation`.
+	/// </summary>
+	/// <typeparam name="GenericType"></typeparam>
+	template<typename GenericType> struct SafeDefaultRelocation : std::true_type
+	{
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="destinationPointer"></param>
+		/// <param name="sourceReference"></param>
+		/// <returns>void</returns>
+		static inline void relocate(GenericType* const destinationPointer,GenericType& sourceReference)
+		{
+			::new(static_cast<void*>(destinationPointer)) GenericType(std::move_if_noexcept(sourceReference));
+			sourceReference.~GenericType();
+		};
+	};
+};
\ No newline at end of file
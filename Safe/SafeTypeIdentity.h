@@ -0,0 +1,293 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <typeinfo>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextBase.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class: `SafeTypeIdentity`.
+	/// </summary>
+	class SafeTypeIdentity final
+	{
+		friend class SafeTypeIdentityRegistry;
+
+	private:
+		const std::type_info* typeInformationPointer;
+		std::uint32_t typeIdentifier;
+		std::size_t hashCode;
+		SafeTypeIdentity* nextIdentityPointer;
+
+		/// <summary>
+		///		Constructor of `SafeTypeIdentity`.
+		/// </summary>
+		/// <param name="typeInformation"></param>
+		/// <param name="typeIdentifier"></param>
+		/// <param name="hashCode"></param>
+		inline explicit SafeTypeIdentity(const std::type_info& typeInformation,const std::uint32_t& typeIdentifier,const std::size_t& hashCode) noexcept : typeInformationPointer(std::addressof(typeInformation)),typeIdentifier(typeIdentifier),hashCode(hashCode),nextIdentityPointer(nullptr)
+		{
+
+		};
+
+		/// <summary>
+		///		Copy constructor of `SafeTypeIdentity`.
+		/// </summary>
+		inline SafeTypeIdentity(const SafeTypeIdentity&) = delete;
+
+		/// <summary>
+		///		Move constructor of `SafeTypeIdentity`.
+		/// </summary>
+		inline SafeTypeIdentity(SafeTypeIdentity&&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeTypeIdentity&amp;</returns>
+		inline SafeTypeIdentity& operator=(const SafeTypeIdentity&) = delete;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		operator=
+		/// </summary>
+		/// <returns>SafeTypeIdentity&amp;</returns>
+		inline SafeTypeIdentity& operator=(SafeTypeIdentity&&) = delete;
+
+	public:
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>type_info&amp;</returns>
+		inline const std::type_info& getTypeInfo() const noexcept
+		{
+			return *(this->typeInformationPointer);
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>uint32_t</returns>
+		inline std::uint32_t getTypeIdentifier() const noexcept
+		{
+			return this->typeIdentifier;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		inline std::size_t getHashCode() const noexcept
+		{
+			return this->hashCode;
+		};
+	};
+
+	/// <summary>
+	///		C++ class: `SafeTypeIdentityRegistry`.
+	/// </summary>
+	class SafeTypeIdentityRegistry final
+	{
+	private:
+		static constexpr std::size_t slotCountBitWidth = 12;
+		static constexpr std::size_t slotCount = (static_cast<std::size_t>(1) << slotCountBitWidth);
+		static constexpr std::size_t maximumSlotLoad = (slotCount / 2);
+
+		/// <summary>
+		///		C++ structure: `SafeTypeIdentityTable`.
+		/// </summary>
+		struct SafeTypeIdentityTable
+		{
+			std::atomic<const SafeTypeIdentity*> slots[SafeTypeIdentityRegistry::slotCount];
+			std::mutex registrationMutex;
+			SafeTypeIdentity* headIdentityPointer;
+			std::size_t slotLoad;
+			std::uint32_t typeCount;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <returns>SafeTypeIdentityTable&amp;</returns>
+		static inline SafeTypeIdentityTable& referToTable() noexcept
+		{
+			static SafeTypeIdentityTable table = SafeTypeIdentityTable{{},{},nullptr,0,0};
+
+			return table;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		///		noexcept
+		/// </summary>
+		/// <param name="typeInformationPointer"></param>
+		/// <returns>size_t</returns>
+		static inline std::size_t locateSlot(const std::type_info* const typeInformationPointer) noexcept
+		{
+			std::uint64_t mixedAddress = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(typeInformationPointer) >> 3) * static_cast<std::uint64_t>(0x9E3779B97F4A7C15ULL);
+
+			return static_cast<std::size_t>(mixedAddress >> (64 - SafeTypeIdentityRegistry::slotCountBitWidth));
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="typeInformation"></param>
+		/// <returns>SafeTypeIdentity&amp;</returns>
+		static inline const SafeTypeIdentity& enlistIdentity(const std::type_info& typeInformation)
+		{
+			SafeTypeIdentityTable& table = SafeTypeIdentityRegistry::referToTable();
+			std::lock_guard<std::mutex> registrationLock(table.registrationMutex);
+			SafeTypeIdentity* identityPointer = table.headIdentityPointer;
+			const SafeTypeIdentity* equivalentIdentityPointer = nullptr;
+
+			while (identityPointer != nullptr)
+			{
+				if (identityPointer->typeInformationPointer == std::addressof(typeInformation))
+				{
+					return *identityPointer;
+				}
+				else if ((equivalentIdentityPointer == nullptr) && (*(identityPointer->typeInformationPointer) == typeInformation))
+				{
+					equivalentIdentityPointer = identityPointer;
+				}
+
+				identityPointer = identityPointer->nextIdentityPointer;
+			}
+
+			if (equivalentIdentityPointer != nullptr)
+			{
+				identityPointer = new SafeTypeIdentity(typeInformation,equivalentIdentityPointer->typeIdentifier,equivalentIdentityPointer->hashCode);
+			}
+			else
+			{
+				identityPointer = new SafeTypeIdentity(typeInformation,++(table.typeCount),typeInformation.hash_code());
+			}
+
+			identityPointer->nextIdentityPointer = table.headIdentityPointer;
+			table.headIdentityPointer = identityPointer;
+
+			if (table.slotLoad < SafeTypeIdentityRegistry::maximumSlotLoad)
+			{
+				std::size_t slotIndex = SafeTypeIdentityRegistry::locateSlot(std::addressof(typeInformation));
+
+				while ((table.slots)[slotIndex].load(std::memory_order_relaxed) != nullptr)
+				{
+					slotIndex = ((slotIndex + 1) & (SafeTypeIdentityRegistry::slotCount - 1));
+				}
+
+				(table.slots)[slotIndex].store(identityPointer,std::memory_order_release);
+				table.slotLoad++;
+			}
+
+			return *identityPointer;
+		};
+
+	public:
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="typeInformation"></param>
+		/// <returns>SafeTypeIdentity&amp;</returns>
+		static inline const SafeTypeIdentity& identify(const std::type_info& typeInformation)
+		{
+			SafeTypeIdentityTable& table = SafeTypeIdentityRegistry::referToTable();
+			std::size_t slotIndex = SafeTypeIdentityRegistry::locateSlot(std::addressof(typeInformation));
+			const SafeTypeIdentity* identityPointer = (table.slots)[slotIndex].load(std::memory_order_acquire);
+
+			while (identityPointer != nullptr)
+			{
+				if (identityPointer->typeInformationPointer == std::addressof(typeInformation))
+				{
+					return *identityPointer;
+				}
+
+				slotIndex = ((slotIndex + 1) & (SafeTypeIdentityRegistry::slotCount - 1));
+				identityPointer = (table.slots)[slotIndex].load(std::memory_order_acquire);
+			}
+
+			return SafeTypeIdentityRegistry::enlistIdentity(typeInformation);
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <param name="instanceReference"></param>
+		/// <returns>SafeTypeIdentity&amp;</returns>
+		static inline const SafeTypeIdentity& identify(const SafeContextBase& instanceReference)
+		{
+			return SafeTypeIdentityRegistry::identify(typeid(instanceReference));
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		/// <returns>SafeTypeIdentity&amp;</returns>
+		template<typename GenericTypeOfSafeContextDerivative> static inline const SafeTypeIdentity& identify()
+		{
+			static const SafeTypeIdentity& identityReference = SafeTypeIdentityRegistry::identify(typeid(GenericTypeOfSafeContextDerivative));
+
+			return identityReference;
+		};
+
+		/// <summary>
+		///		static
+		///		inline
+		/// </summary>
+		/// <returns>uint32_t</returns>
+		static inline std::uint32_t getTypeCount()
+		{
+			SafeTypeIdentityTable& table = SafeTypeIdentityRegistry::referToTable();
+			std::lock_guard<std::mutex> registrationLock(table.registrationMutex);
+
+			return table.typeCount;
+		};
+	};
+};
\ No newline at end of file
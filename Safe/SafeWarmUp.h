@@ -0,0 +1,109 @@
+/// <summary>
+///		Legal & Licensing Information
+/// </summary>
+/// <remarks>
+///		Required Notice: Copyright@2026 Duc Nguyen (workofduc@gmail.com) [cite: 6, 7]
+///		This software is licensed under the PolyForm Noncommercial License 1.0.0. [cite: 1]
+/// 
+///		PERMITTED USE:
+///		Any noncommercial purpose is a permitted purpose. [cite: 9]
+///		Personal use for research, hobby projects, or personal study is permitted. [cite: 9]
+/// 
+///		DISTRIBUTION:
+///		Redistribution is permitted only under the terms of the PolyForm Noncommercial License. [cite: 3, 4, 5]
+/// 
+///		COMMERCIAL USE:
+///		Commercial use is NOT permitted under these terms. 
+///		To obtain a commercial license, please contact me via email: workofduc@gmail.com [cite: 23]
+/// </remarks>
+
+#pragma once
+
+/** Inclusion(s) of C++ standard library header file(s).**/
+#include <chrono>
+#include <vector>
+
+/** Inclusion(s) of project's C++ header file(s).**/
+#include "SafeContextBase.h"
+#include "SafeContextException.h"
+#include "SafeContextStatistics.h"
+
+
+/** Main code.**/
+
+/// <summary>
+///		C++ namespace: `Safe`.
+/// </summary>
+namespace Safe
+{
+	/// <summary>
+	///		C++ class: `SafeWarmUpPlan`.
+	/// </summary>
+	class SafeWarmUpPlan final
+	{
+	private:
+		/// <summary>
+		///		C++ structure: `SafeWarmUpEntry`.
+		/// </summary>
+		struct SafeWarmUpEntry
+		{
+			std::size_t reservedCount;
+			std::size_t (*reserveFunctionPointer)(const std::size_t&,const std::size_t&);
+		};
+
+		std::vector<SafeWarmUpEntry> entries;
+
+	public:
+		/// <summary>
+		///		Constructor of `SafeWarmUpPlan`.
+		/// </summary>
+		inline explicit SafeWarmUpPlan() = default;
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <typeparam name="GenericTypeOfSafeContextDerivative"></typeparam>
+		/// <param name="reservedCount"></param>
+		/// <returns>SafeWarmUpPlan&amp;</returns>
+		template<typename GenericTypeOfSafeContextDerivative> inline SafeWarmUpPlan& add(const std::size_t& reservedCount)
+		{
+			(this->entries).push_back(SafeWarmUpEntry{reservedCount,&SafeContextBase::reserve<GenericTypeOfSafeContextDerivative>});
+
+			return *this;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		inline
+		/// </summary>
+		/// <param name="parallelism"></param>
+		/// <returns>nanoseconds</returns>
+		/// <exception cref="SafeContextException"/>
+		inline std::chrono::nanoseconds execute(const std::size_t& parallelism = 1) const
+		{
+			std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			std::size_t i = 0;
+
+			for (i = 0;i < (this->entries).size();i++)
+			{
+				((this->entries)[i].reserveFunctionPointer)((this->entries)[i].reservedCount,parallelism);
+			}
+
+			std::chrono::nanoseconds warmUpDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+			SafeContextStatistics::recordLastWarmUp(warmUpDuration);
+
+			return warmUpDuration;
+		};
+
+		/// <summary>
+		///		dynamic
+		///		noexcept
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t getEntryCount() const noexcept
+		{
+			return (this->entries).size();
+		};
+	};
+};
\ No newline at end of file